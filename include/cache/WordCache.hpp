@@ -21,31 +21,97 @@
  * OUT OF OR IN CONNECTION WITH THE SOFTWARE  OR THE USE OR OTHER DEALINGS IN THE
  * SOFTWARE.
  */
-
 #pragma once
 
-#include <QAtomicPointer>
+#include <QHash>
+#include <QMutex>
+
+#include <array>
+#include <atomic>
+#include <list>
+#include <memory>
+#include <optional>
 
 #include "common/Word.hpp"
 
 namespace grunwald {
 
+    /*
+     * Current word shown by the detail view plus an LRU cache of looked up words
+     * keyed by exact headword, so "Masse" never answers for "Maße". The keyed
+     * part is split into shards, each with its own mutex, LRU list and share of
+     * the byte budget, so the GUI thread and image provider threads rarely
+     * contend.
+     *
+     * The current word is an immutable snapshot, a store publishes a new one
+     * with a single atomic swap, so readers never see a half-written word.
+     * Writers are serialized, readers don't lock.
+     */
     class WordCache final {
     public:
-        WordCache();
+        static constexpr qint64 DEFAULT_BYTE_BUDGET = 16 * 1024 * 1024;
+
+        struct Stats final {
+            qint64 hits;
+            qint64 misses;
+            qint64 evictions;
+            qint64 bytes;
+            qint64 count;
+        };
+
+        explicit WordCache(qint64 byteBudget = DEFAULT_BYTE_BUDGET);
         ~WordCache();
 
         bool isValid() const;
+        auto generation() const -> quint64;
         void clear();
 
         void storeWordContent(const Word& newWord);
-        void storeWordImage(const WordImage& wordImage);
+        void storeWordImage(const QString& name, const WordImage& wordImage);
 
         auto loadWordContent() const -> Word;
-        auto loadWordImage() const -> WordImage;
+        auto loadSnapshot() const -> std::shared_ptr<const Word>;
+
+        void insert(const Word& word);
+        void remove(const QString& name);
+
+        auto find(const QString& name) -> std::optional<Word>;
+        auto find(qint64 id) -> std::optional<Word>;
+
+        auto stats() const -> Stats;
 
     private:
-        QAtomicPointer<Word> mData;
+        static constexpr qsizetype SHARD_COUNT = 16;
+
+        struct Entry final {
+            QString key;
+            Word word;
+            qint64 bytes;
+        };
+
+        struct Shard final {
+            mutable QMutex mutex;
+            std::list<Entry> entries;  // most recently used first
+            QHash<QString, std::list<Entry>::iterator> keys;
+            QHash<qint64, std::list<Entry>::iterator> ids;
+            qint64 bytes = 0;
+            qint64 hits = 0;
+            qint64 misses = 0;
+            qint64 evictions = 0;
+        };
+
+        auto shard(const QString& key) -> Shard&;
+        void store(Shard& shard, QString key, const Word& word);
+        void erase(Shard& shard, std::list<Entry>::iterator entry);
+
+        void publish(std::shared_ptr<const Word> snapshot);
+
+        QMutex mPublishMutex;
+        std::atomic<std::shared_ptr<const Word>> mData;
+        std::atomic<quint64> mGeneration;  // publications count << 1 | has word
+
+        qint64 mShardBudget;
+        std::array<Shard, SHARD_COUNT> mShards;
 
         const static Word EMPTY_WORD;
     };
@@ -0,0 +1,146 @@
+/*
+ * Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+ * SPDX-License-Identifier: MIT
+ * Copyright (c) 2023-2025 https://github.com/klappdev
+ *
+ * Permission is hereby  granted, free of charge, to any  person obtaining a copy
+ * of this software and associated  documentation files (the "Software"), to deal
+ * in the Software  without restriction, including without  limitation the rights
+ * to  use, copy,  modify, merge,  publish, distribute,  sublicense, and/or  sell
+ * copies  of  the Software,  and  to  permit persons  to  whom  the Software  is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE  IS PROVIDED "AS  IS", WITHOUT WARRANTY  OF ANY KIND,  EXPRESS OR
+ * IMPLIED,  INCLUDING BUT  NOT  LIMITED TO  THE  WARRANTIES OF  MERCHANTABILITY,
+ * FITNESS FOR  A PARTICULAR PURPOSE AND  NONINFRINGEMENT. IN NO EVENT  SHALL THE
+ * AUTHORS  OR COPYRIGHT  HOLDERS  BE  LIABLE FOR  ANY  CLAIM,  DAMAGES OR  OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF  CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE  OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+#include <QFuture>
+#include <QImage>
+#include <QMutex>
+#include <QPromise>
+#include <QThread>
+#include <QThreadPool>
+
+#include <memory>
+#include <type_traits>
+
+#include "db/WordDao.hpp"
+
+namespace grunwald {
+
+    /*
+     * Runs WordDao writes on a dedicated database thread, they are queued into
+     * the thread event loop and executed in order. Reads, image decoding
+     * included, run in a small pool with one reader connection per task, so
+     * a slow read doesn't hold back other reads or writes. A read starts after
+     * every write submitted before it, results come back as futures.
+     */
+    class AsyncWordDao final : public QObject {
+        Q_OBJECT
+    public:
+        explicit AsyncWordDao(QObject* parent = nullptr);
+        ~AsyncWordDao();
+
+        AsyncWordDao(const AsyncWordDao&) = delete;
+        AsyncWordDao& operator=(AsyncWordDao&) = delete;
+
+        auto reset() -> QFuture<void>;
+        auto checkIfExists(const QString& name) -> QFuture<bool>;
+
+        auto add(const Word& word) -> QFuture<Result<void, DbError>>;
+        auto update(const Word& word) -> QFuture<Result<void, DbError>>;
+        auto remove(const Word& word) -> QFuture<Result<void, DbError>>;
+
+        auto addBatch(const QVector<Word>& words) -> QFuture<QVector<Result<void, DbError>>>;
+        auto applyBatch(const QVector<WordChange>& changes) -> QFuture<QVector<Result<void, DbError>>>;
+        auto updateBatch(const QVector<Word>& words) -> QFuture<QVector<Result<void, DbError>>>;
+
+        auto get(qint32 id) -> QFuture<Result<Word, DbError>>;
+        auto getAll() -> QFuture<Result<QVector<Word>, DbError>>;
+        auto getNames() -> QFuture<Result<QStringList, DbError>>;
+        auto search(const QString& name) -> QFuture<Result<QVector<Word>, DbError>>;
+        auto fullTextSearch(const QString& text, qint32 limit) -> QFuture<Result<QVector<Word>, DbError>>;
+        auto page(const QString& afterName, qint64 afterId, qint32 limit) -> QFuture<Result<QVector<Word>, DbError>>;
+        auto loadImageData(qint64 imageId) -> QFuture<Result<QByteArray, DbError>>;
+
+        /*
+         * Decodes image straight from the BLOB stream, scaled while decoding
+         * when scaledSize is valid, so encoded bytes are never held in memory.
+         */
+        auto loadImage(qint64 imageId, const QSize& scaledSize) -> QFuture<Result<QImage, DbError>>;
+
+        auto findMiss(const QString& name) -> QFuture<Result<std::optional<WordMiss>, DbError>>;
+        auto addMiss(const WordMiss& miss, qint32 limit) -> QFuture<Result<void, DbError>>;
+
+        auto optimize() -> QFuture<Result<void, DbError>>;
+        auto analyze() -> QFuture<Result<void, DbError>>;
+        auto incrementalVacuum(qint32 maxPages) -> QFuture<Result<WordDao::VacuumStats, DbError>>;
+
+    private:
+        template<typename F>
+        auto submit(F&& function) -> QFuture<std::invoke_result_t<F, WordDao&>>;
+
+        template<typename F>
+        auto submitRead(F&& function) -> QFuture<std::invoke_result_t<F, WordDao&>>;
+
+        QThread mThread;
+        QThreadPool mReaderPool;
+        std::unique_ptr<QObject> mContext;
+        std::unique_ptr<WordDao> mWordDao;
+
+        QMutex mWriteMutex;
+        QFuture<void> mLastWrite;
+    };
+
+    template<typename F>
+    auto AsyncWordDao::submit(F&& function) -> QFuture<std::invoke_result_t<F, WordDao&>> {
+        using R = std::invoke_result_t<F, WordDao&>;
+
+        auto promise = std::make_shared<QPromise<R>>();
+        QFuture<R> future = promise->future();
+
+        promise->start();
+
+        QMetaObject::invokeMethod(mContext.get(), [this, promise, function = std::forward<F>(function)]() mutable {
+            if constexpr (std::is_void_v<R>) {
+                function(*mWordDao);
+            } else {
+                promise->addResult(function(*mWordDao));
+            }
+
+            promise->finish();
+        }, Qt::QueuedConnection);
+
+        QMutexLocker locker(&mWriteMutex);
+        mLastWrite = future.then([](const QFuture<R>&) {});
+
+        return future;
+    }
+
+    template<typename F>
+    auto AsyncWordDao::submitRead(F&& function) -> QFuture<std::invoke_result_t<F, WordDao&>> {
+        using R = std::invoke_result_t<F, WordDao&>;
+
+        QFuture<void> lastWrite;
+        {
+            QMutexLocker locker(&mWriteMutex);
+            lastWrite = mLastWrite;
+        }
+
+        return lastWrite.then(&mReaderPool, [this, function = std::forward<F>(function)]() mutable -> R {
+            const WordConnectionPool::Lease lease = mWordDao->leaseConnection();
+
+            return function(*mWordDao);
+        });
+    }
+}
@@ -0,0 +1,82 @@
+/*
+ * Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+ * SPDX-License-Identifier: MIT
+ * Copyright (c) 2023-2025 https://github.com/klappdev
+ *
+ * Permission is hereby  granted, free of charge, to any  person obtaining a copy
+ * of this software and associated  documentation files (the "Software"), to deal
+ * in the Software  without restriction, including without  limitation the rights
+ * to  use, copy,  modify, merge,  publish, distribute,  sublicense, and/or  sell
+ * copies  of  the Software,  and  to  permit persons  to  whom  the Software  is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE  IS PROVIDED "AS  IS", WITHOUT WARRANTY  OF ANY KIND,  EXPRESS OR
+ * IMPLIED,  INCLUDING BUT  NOT  LIMITED TO  THE  WARRANTIES OF  MERCHANTABILITY,
+ * FITNESS FOR  A PARTICULAR PURPOSE AND  NONINFRINGEMENT. IN NO EVENT  SHALL THE
+ * AUTHORS  OR COPYRIGHT  HOLDERS  BE  LIABLE FOR  ANY  CLAIM,  DAMAGES OR  OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF  CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE  OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+#include <QtSql>
+
+#include <sqlite3.h>
+
+namespace grunwald {
+
+    /*
+     * A handle of the QSQLITE driver may be passed to the SQLite library the
+     * application links only when both are one library, i.e. Qt is built with
+     * -system-sqlite. A driver with a bundled copy runs another build, which
+     * the source id of the library answering SQL tells apart.
+     */
+    inline bool checkSqliteLibrary(const QSqlDatabase& database) {
+        QSqlQuery query(database);
+
+        if (!query.exec("SELECT sqlite_source_id()") || !query.first()) {
+            qWarning() << "[SqliteHandle] " << "SQLite source id is not available: " << query.lastError() << Qt::endl;
+            return false;
+        }
+
+        const QString driverSourceId = query.value(0).toString();
+        const QString linkedSourceId = QString::fromLatin1(sqlite3_sourceid());
+
+        if (driverSourceId != linkedSourceId) {
+            qWarning() << "[SqliteHandle] " << "QSQLITE driver uses its own SQLite " << driverSourceId
+                       << ", application links " << linkedSourceId << ", direct SQLite calls are disabled" << Qt::endl;
+            return false;
+        }
+
+        return true;
+    }
+
+    /*
+     * Raw handle behind a QSQLITE connection, nullptr when the connection
+     * is closed, uses another driver or another SQLite library.
+     */
+    inline auto sqliteHandle(const QSqlDatabase& database) -> sqlite3* {
+        if (!database.isOpen() || database.driver() == nullptr || database.driverName() != "QSQLITE") {
+            return nullptr;
+        }
+
+        static const bool sameLibrary = checkSqliteLibrary(database);
+
+        if (!sameLibrary) {
+            return nullptr;
+        }
+
+        QVariant handle = database.driver()->handle();
+
+        if (!handle.isValid() || qstrcmp(handle.typeName(), "sqlite3*") != 0) {
+            return nullptr;
+        }
+
+        return *static_cast<sqlite3**>(handle.data());
+    }
+}
@@ -0,0 +1,72 @@
+/*
+ * Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+ * SPDX-License-Identifier: MIT
+ * Copyright (c) 2023-2025 https://github.com/klappdev
+ *
+ * Permission is hereby  granted, free of charge, to any  person obtaining a copy
+ * of this software and associated  documentation files (the "Software"), to deal
+ * in the Software  without restriction, including without  limitation the rights
+ * to  use, copy,  modify, merge,  publish, distribute,  sublicense, and/or  sell
+ * copies  of  the Software,  and  to  permit persons  to  whom  the Software  is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE  IS PROVIDED "AS  IS", WITHOUT WARRANTY  OF ANY KIND,  EXPRESS OR
+ * IMPLIED,  INCLUDING BUT  NOT  LIMITED TO  THE  WARRANTIES OF  MERCHANTABILITY,
+ * FITNESS FOR  A PARTICULAR PURPOSE AND  NONINFRINGEMENT. IN NO EVENT  SHALL THE
+ * AUTHORS  OR COPYRIGHT  HOLDERS  BE  LIABLE FOR  ANY  CLAIM,  DAMAGES OR  OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF  CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE  OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+#include <QIODevice>
+#include <QtSql>
+
+struct sqlite3;
+struct sqlite3_blob;
+
+namespace grunwald {
+
+    /*
+     * Read-only device over a single SQLite BLOB cell. Bytes are read through
+     * incremental BLOB I/O on demand, so a consumer like QImageReader never
+     * needs the whole value copied into a QByteArray.
+     *
+     * The device must be used and destroyed on the thread which owns the
+     * database connection, and SQLite linked into the application must be the
+     * same library the QSQLITE driver uses (Qt built with -system-sqlite).
+     */
+    class WordBlobDevice final : public QIODevice {
+        Q_OBJECT
+    public:
+        WordBlobDevice(const QSqlDatabase& database, const QString& table, const QString& column, qint64 rowId);
+        ~WordBlobDevice();
+
+        WordBlobDevice(const WordBlobDevice&) = delete;
+        WordBlobDevice& operator=(WordBlobDevice&) = delete;
+
+        bool open(OpenMode mode) override;
+        void close() override;
+
+        bool isSequential() const override;
+        qint64 size() const override;
+
+    protected:
+        qint64 readData(char* data, qint64 maxSize) override;
+        qint64 writeData(const char* data, qint64 maxSize) override;
+
+    private:
+        sqlite3* mHandle;
+        sqlite3_blob* mBlob;
+        qint64 mSize;
+
+        QByteArray mTable;
+        QByteArray mColumn;
+        qint64 mRowId;
+    };
+}
@@ -0,0 +1,123 @@
+/*
+ * Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+ * SPDX-License-Identifier: MIT
+ * Copyright (c) 2023-2025 https://github.com/klappdev
+ *
+ * Permission is hereby  granted, free of charge, to any  person obtaining a copy
+ * of this software and associated  documentation files (the "Software"), to deal
+ * in the Software  without restriction, including without  limitation the rights
+ * to  use, copy,  modify, merge,  publish, distribute,  sublicense, and/or  sell
+ * copies  of  the Software,  and  to  permit persons  to  whom  the Software  is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE  IS PROVIDED "AS  IS", WITHOUT WARRANTY  OF ANY KIND,  EXPRESS OR
+ * IMPLIED,  INCLUDING BUT  NOT  LIMITED TO  THE  WARRANTIES OF  MERCHANTABILITY,
+ * FITNESS FOR  A PARTICULAR PURPOSE AND  NONINFRINGEMENT. IN NO EVENT  SHALL THE
+ * AUTHORS  OR COPYRIGHT  HOLDERS  BE  LIABLE FOR  ANY  CLAIM,  DAMAGES OR  OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF  CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE  OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+#include <QtSql>
+#include <QMutex>
+#include <QThread>
+#include <QWaitCondition>
+
+#include <memory>
+#include <unordered_map>
+
+namespace grunwald {
+
+    /*
+     * Read-only SQLite connections for lookups running off the writer thread
+     * while the database is in WAL journal mode. Qt allows a connection only
+     * on the thread which opened it, so every reader thread gets its own
+     * connection on first use and keeps it, with its prepared statements,
+     * until the thread finishes and closes it. A new thread waits up to
+     * ACQUIRE_TIMEOUT_MS when maxConnections threads already hold one.
+     *
+     * Reader threads should finish before the pool is destroyed, a connection
+     * of a thread still running is left open rather than closed from another one.
+     */
+    class WordConnectionPool final {
+    public:
+        static constexpr qint32 ACQUIRE_TIMEOUT_MS = 5000;
+
+        /*
+         * Allows the calling thread to use its connection until destroyed.
+         * Leases taken again on the same thread share the connection.
+         */
+        class Lease final {
+        public:
+            Lease() = default;
+            ~Lease();
+
+            Lease(Lease&& other) noexcept;
+            Lease& operator=(Lease&& other) noexcept;
+
+            Lease(const Lease&) = delete;
+            Lease& operator=(const Lease&) = delete;
+
+            bool isValid() const;
+
+        private:
+            friend class WordConnectionPool;
+
+            Lease(WordConnectionPool* pool, QThread* thread);
+
+            WordConnectionPool* mPool = nullptr;
+            QThread* mThread = nullptr;
+        };
+
+        WordConnectionPool(const QString& databaseName, const QString& connectionPrefix, qint32 maxConnections);
+        ~WordConnectionPool();
+
+        WordConnectionPool(const WordConnectionPool&) = delete;
+        WordConnectionPool& operator=(WordConnectionPool&) = delete;
+
+        void setStatements(const QStringList& statements);
+
+        auto acquire() -> Lease;
+
+        /*
+         * Statement and database of the connection leased by the calling thread,
+         * nullptr and an invalid database when the thread holds no lease.
+         */
+        auto statement(qsizetype index) -> QSqlQuery*;
+        auto database() -> QSqlDatabase;
+        auto size() const -> qint32;
+
+        void closeAll();
+
+    private:
+        struct Connection final {
+            QString name;
+            QSqlDatabase database;
+            QVector<QSqlQuery> statements;
+            QMetaObject::Connection threadFinished;
+            qint32 leaseCount;
+        };
+
+        auto leasedConnection() -> Connection*;
+        bool openConnection(Connection& connection);
+        void closeConnection(Connection& connection);
+        void closeThreadConnection(QThread* thread);
+        void release(QThread* thread);
+
+        QString mDatabaseName;
+        QString mConnectionPrefix;
+        qint32 mMaxConnections;
+        quint32 mConnectionCounter;
+        QStringList mStatements;
+
+        mutable QMutex mMutex;
+        QWaitCondition mConnectionClosed;
+        std::unordered_map<QThread*, std::unique_ptr<Connection>> mConnections;
+    };
+}
@@ -25,7 +25,15 @@
 #pragma once
 
 #include <QtSql>
+#include <QSpan>
 
+#include <array>
+#include <functional>
+#include <memory>
+#include <optional>
+
+#include "db/WordBlobDevice.hpp"
+#include "db/WordConnectionPool.hpp"
 #include "common/Word.hpp"
 #include "util/Result.hpp"
 #include "util/Error.hpp"
@@ -33,14 +41,70 @@
 namespace grunwald {
     using DbError = Error;
 
+    struct WordChange final {
+        enum class Type {
+            Add,
+            Remove
+        };
+
+        Type type;
+        Word word;
+    };
+
+    /*
+     * Word the remote dictionary doesn't have, remembered until expiresAt.
+     */
+    struct WordMiss final {
+        QString name;
+        qint32 reason;
+        QDateTime expiresAt;
+    };
+
     class WordDao final {
     public:
-        WordDao();
+        /*
+         * ReadOnly opens an existing database as found: the file is not created
+         * and its schema is neither migrated nor vacuumed.
+         */
+        enum class JournalMode {
+            Exclusive,
+            Wal,
+            ReadOnly
+        };
+
+        /*
+         * Encoding used when HTML fields are written, reading handles both.
+         */
+        enum class TextEncoding {
+            Plain,
+            Compressed
+        };
+
+        struct VacuumStats final {
+            qint64 reclaimedBytes;
+            qint64 freePages;
+        };
+
+        /*
+         * Read-only connections opened next to the writer one in WAL journal mode.
+         */
+        static constexpr qint32 READER_CONNECTIONS = 4;
+
+        explicit WordDao(JournalMode journalMode = JournalMode::Wal, TextEncoding textEncoding = TextEncoding::Compressed);
+        WordDao(const QString& databaseName, JournalMode journalMode, TextEncoding textEncoding);
         ~WordDao();
 
         WordDao(const WordDao&) = delete;
         WordDao& operator=(WordDao&) = delete;
 
+        /*
+         * Reader connection of the calling thread, usable while the lease lives.
+         * It is opened on the first lease and closed when the thread finishes.
+         * Calls from any thread except the owner one need a lease, the owner
+         * thread uses the writer connection and gets an empty lease.
+         */
+        auto leaseConnection() -> WordConnectionPool::Lease;
+
         void reset();
         bool checkIfExists(const QString& name);
 
@@ -48,19 +112,121 @@ namespace grunwald {
         auto update(const Word& word) -> Result<void, DbError>;
         auto remove(const Word& word) -> Result<void, DbError>;
 
+        auto addBatch(QSpan<const Word> words) -> QVector<Result<void, DbError>>;
+        auto applyBatch(QSpan<const WordChange> changes) -> QVector<Result<void, DbError>>;
+        auto updateBatch(QSpan<const Word> words) -> QVector<Result<void, DbError>>;
+
         auto get(qint32 id) -> Result<Word, DbError>;
         auto getAll() -> Result<QVector<Word>, DbError>;
+        auto getNames() -> Result<QStringList, DbError>;
         auto search(const QString& name) -> Result<QVector<Word>, DbError>;
+        auto fullTextSearch(const QString& text, qint32 limit) -> Result<QVector<Word>, DbError>;
+
+        /*
+         * Keyset pagination ordered by (name, id): returns up to `limit` words after the given key,
+         * pass an empty name and zero id for the first page.
+         */
+        auto page(const QString& afterName, qint64 afterId, qint32 limit) -> Result<QVector<Word>, DbError>;
+
+        /*
+         * List queries project only image metadata, image bytes are loaded on demand.
+         */
+        auto loadImageData(qint64 imageId) -> Result<QByteArray, DbError>;
+
+        /*
+         * Opens image bytes as a read-only stream over the BLOB cell, nothing
+         * is copied up front. The device is bound to the connection of the
+         * calling thread and must not outlive it. Without direct SQLite access
+         * (see SqliteHandle.hpp) the bytes are loaded into a buffer instead.
+         */
+        auto openImageStream(qint64 imageId) -> Result<std::unique_ptr<QIODevice>, DbError>;
+
+        /*
+         * Negative cache of remote lookups by exact headword, the reason is the
+         * answer class of the remote dictionary. findMiss() ignores expired
+         * entries, addMiss() drops them and keeps at most `limit` latest ones.
+         */
+        auto findMiss(const QString& name) -> Result<std::optional<WordMiss>, DbError>;
+        auto addMiss(const WordMiss& miss, qint32 limit) -> Result<void, DbError>;
+
+        /*
+         * Maintenance steps, each one is bounded so it can run between other requests.
+         * incrementalVacuum() returns at most maxPages free pages back to the file system.
+         */
+        auto optimize() -> Result<void, DbError>;
+        auto analyze() -> Result<void, DbError>;
+        auto incrementalVacuum(qint32 maxPages) -> Result<VacuumStats, DbError>;
 
     private:
-        auto openDatabase() -> QSqlDatabase;
+        enum class Statement : std::size_t {
+            CheckIfExists,
+            FindImage,
+            AddImage,
+            AddWord,
+            UpdateWordByName,
+            UpdateWord,
+            RemoveWord,
+            Get,
+            GetAll,
+            GetNames,
+            Search,
+            FullTextSearch,
+            Page,
+            LoadImageData,
+            FindMiss,
+            AddMiss,
+            PruneMisses,
+
+            Count
+        };
+
+        using Operation = std::function<auto (qsizetype index) -> Result<void, DbError>>;
+
+        auto openDatabase(const QString& databaseName) -> QSqlDatabase;
         void closeDatabase();
         void createTables();
+        bool createMissTable();
+        void enableIncrementalVacuum();
+        auto pragmaValue(const QString& pragma) -> qint64;
+        void migrateTables();
+        bool migrateNameKey();
+        bool migrateImageHash();
+        bool migrateFullTextTriggers();
+        bool migrateMisses();
+        auto schemaVersion() -> qint32;
+        void createFullTextIndex();
+        auto fullTextTriggerSql() -> QString;
+        void dropFullTextTriggers();
+        void decodeStoredText();
+        void prepareStatements();
+
+        auto statement(Statement type) -> QSqlQuery*;
+        auto connection() -> QSqlDatabase;
 
-        auto prepareWord() -> Word;
+        auto encodeText(const QString& text) const -> QVariant;
+        auto storeImage(const WordImage& image) -> Result<qint64, DbError>;
+        auto insert(const Word& word) -> Result<void, DbError>;
+        auto modify(const Word& word) -> Result<void, DbError>;
+        auto executeBatch(qsizetype count, const Operation& operation) -> QVector<Result<void, DbError>>;
+        auto prepareWord(const QSqlQuery& query, bool withImageData) -> Word;
 
+        JournalMode  mJournalMode;
+        TextEncoding mTextEncoding;
+        bool         mTextFunctions;
+        QThread*     mOwnerThread;
         QSqlDatabase mDatabase;
         QSqlQuery    mSqlQuery;
-        QSqlRecord   mSqlRecord;
+
+        /*
+         * Used for calls coming from any thread except the owner one while
+         * they hold a lease, available only in WAL journal mode.
+         */
+        WordConnectionPool mConnectionPool;
+
+        /*
+         * Statements are compiled once after tables are created and only rebound on each call,
+         * so SQLite doesn't parse and plan the same SQL for every lookup.
+         */
+        std::array<QSqlQuery, static_cast<std::size_t>(Statement::Count)> mStatements;
     };
 }
@@ -0,0 +1,89 @@
+/*
+ * Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+ * SPDX-License-Identifier: MIT
+ * Copyright (c) 2023-2025 https://github.com/klappdev
+ *
+ * Permission is hereby  granted, free of charge, to any  person obtaining a copy
+ * of this software and associated  documentation files (the "Software"), to deal
+ * in the Software  without restriction, including without  limitation the rights
+ * to  use, copy,  modify, merge,  publish, distribute,  sublicense, and/or  sell
+ * copies  of  the Software,  and  to  permit persons  to  whom  the Software  is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE  IS PROVIDED "AS  IS", WITHOUT WARRANTY  OF ANY KIND,  EXPRESS OR
+ * IMPLIED,  INCLUDING BUT  NOT  LIMITED TO  THE  WARRANTIES OF  MERCHANTABILITY,
+ * FITNESS FOR  A PARTICULAR PURPOSE AND  NONINFRINGEMENT. IN NO EVENT  SHALL THE
+ * AUTHORS  OR COPYRIGHT  HOLDERS  BE  LIABLE FOR  ANY  CLAIM,  DAMAGES OR  OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF  CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE  OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+#include <QDeadlineTimer>
+#include <QElapsedTimer>
+#include <QTimer>
+
+#include "db/AsyncWordDao.hpp"
+
+namespace grunwald {
+
+    /*
+     * Runs database maintenance while the user is idle: PRAGMA optimize,
+     * incremental vacuum in page chunks sized to a time budget and ANALYZE.
+     * Every step is a separate database request started from the event loop
+     * after a short pause, so lookups made in between are not held back,
+     * and a pass pauses as soon as input arrives.
+     */
+    class WordMaintenance final : public QObject {
+        Q_OBJECT
+    public:
+        explicit WordMaintenance(AsyncWordDao* wordDao, QObject* parent = nullptr);
+        ~WordMaintenance();
+
+        WordMaintenance(const WordMaintenance&) = delete;
+        WordMaintenance& operator=(WordMaintenance&) = delete;
+
+    signals:
+        void maintenanceFinished(qint64 reclaimedBytes, qint64 elapsedMs);
+
+    protected:
+        bool eventFilter(QObject* watched, QEvent* event) override;
+
+    private slots:
+        void onIdleCheck();
+        void runStep();
+
+    private:
+        enum class Step {
+            None,
+            Optimize,
+            Vacuum,
+            Analyze
+        };
+
+        void startPass();
+        void finishStep(Step nextStep, qint64 stepElapsedMs);
+        void finishPass();
+
+        bool isUserIdle() const;
+
+        AsyncWordDao* mWordDao;
+
+        QTimer mIdleTimer;
+        QTimer mStepTimer;
+        QElapsedTimer mActivityTimer;
+        QDeadlineTimer mNextPassDeadline;
+
+        Step mStep;
+        bool mStepRunning;
+        qint32 mVacuumPages;
+
+        qint64 mReclaimedBytes;
+        qint64 mElapsedMs;
+    };
+}
@@ -26,6 +26,7 @@
 
 #include <QQuickAsyncImageProvider>
 
+#include "image/WordImageCache.hpp"
 #include "storage/WordStorage.hpp"
 
 namespace grunwald {
@@ -33,13 +34,15 @@ namespace grunwald {
     class AsyncWordImageProvider final : public QQuickAsyncImageProvider {
         Q_OBJECT
     public:
-        explicit AsyncWordImageProvider(WordCache* wordCache);
+        AsyncWordImageProvider(WordCache* wordCache, WordImageCache* imageCache, WordStorage* wordStorage);
         ~AsyncWordImageProvider();
 
         QQuickImageResponse* requestImageResponse(const QString& imageId, const QSize& requestedSize) override;
 
     private:
         WordCache* mWordCache;
+        WordImageCache* mImageCache;
+        WordStorage* mWordStorage;
     };
 }
 
@@ -27,6 +27,8 @@
 #include <QQuickImageProvider>
 
 #include "cache/WordCache.hpp"
+#include "image/WordImageCache.hpp"
+#include "storage/WordStorage.hpp"
 #include "net/WordImageService.hpp"
 
 namespace grunwald {
@@ -34,7 +36,8 @@ namespace grunwald {
     class AsyncWordImageResponse final : public QQuickImageResponse {
         Q_OBJECT
     public:
-        AsyncWordImageResponse(WordCache* wordCache, const QString& imageId, const QSize& requestedSize);
+        AsyncWordImageResponse(WordCache* wordCache, WordStorage* wordStorage, WordImageCache* imageCache,
+                               const QString& imageId, const QSize& requestedSize);
         ~AsyncWordImageResponse();
 
         QQuickTextureFactory* textureFactory() const override;
@@ -46,10 +49,15 @@ namespace grunwald {
 
     private:
         void searchWordImage(const QString& name);
+        void finishImage(const QImage& image);
+        auto prepareImageSize(const WordImage& wordImage) const -> QSize;
 
         WordCache* mWordCache;
+        WordStorage* mWordStorage;
+        WordImageCache* mImageCache;
         WordImageService mWordImageService;
 
+        QString mName;
         QImage mImage;
         QSize mRequestedSize;
     };
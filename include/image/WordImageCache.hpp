@@ -0,0 +1,62 @@
+/*
+ * Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+ * SPDX-License-Identifier: MIT
+ * Copyright (c) 2023-2025 https://github.com/klappdev
+ *
+ * Permission is hereby  granted, free of charge, to any  person obtaining a copy
+ * of this software and associated  documentation files (the "Software"), to deal
+ * in the Software  without restriction, including without  limitation the rights
+ * to  use, copy,  modify, merge,  publish, distribute,  sublicense, and/or  sell
+ * copies  of  the Software,  and  to  permit persons  to  whom  the Software  is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE  IS PROVIDED "AS  IS", WITHOUT WARRANTY  OF ANY KIND,  EXPRESS OR
+ * IMPLIED,  INCLUDING BUT  NOT  LIMITED TO  THE  WARRANTIES OF  MERCHANTABILITY,
+ * FITNESS FOR  A PARTICULAR PURPOSE AND  NONINFRINGEMENT. IN NO EVENT  SHALL THE
+ * AUTHORS  OR COPYRIGHT  HOLDERS  BE  LIABLE FOR  ANY  CLAIM,  DAMAGES OR  OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF  CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE  OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+#include <QCache>
+#include <QHash>
+#include <QImage>
+#include <QMutex>
+#include <QSize>
+
+#include <optional>
+
+namespace grunwald {
+
+    /*
+     * Decoded images keyed by word name and requested size, shared by all
+     * responses of the provider and invalidated by WordStorage. All sizes of
+     * a word form one entry costing their pixel memory, so removing a word is
+     * a single lookup. Least recently used words are evicted first once the
+     * budget is exceeded.
+     */
+    class WordImageCache final {
+    public:
+        static constexpr qint64 DEFAULT_BYTE_BUDGET = 48 * 1024 * 1024;
+
+        explicit WordImageCache(qint64 byteBudget = DEFAULT_BYTE_BUDGET);
+
+        auto find(const QString& name, const QSize& requestedSize) -> std::optional<QImage>;
+        void insert(const QString& name, const QSize& requestedSize, const QImage& image);
+        void remove(const QString& name);
+
+    private:
+        using SizedImages = QHash<quint64, QImage>;
+
+        static auto prepareKey(const QSize& requestedSize) -> quint64;
+
+        QMutex mMutex;
+        QCache<QString, SizedImages> mImages;
+    };
+}
@@ -0,0 +1,54 @@
+/*
+ * Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+ * SPDX-License-Identifier: MIT
+ * Copyright (c) 2023-2025 https://github.com/klappdev
+ *
+ * Permission is hereby  granted, free of charge, to any  person obtaining a copy
+ * of this software and associated  documentation files (the "Software"), to deal
+ * in the Software  without restriction, including without  limitation the rights
+ * to  use, copy,  modify, merge,  publish, distribute,  sublicense, and/or  sell
+ * copies  of  the Software,  and  to  permit persons  to  whom  the Software  is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE  IS PROVIDED "AS  IS", WITHOUT WARRANTY  OF ANY KIND,  EXPRESS OR
+ * IMPLIED,  INCLUDING BUT  NOT  LIMITED TO  THE  WARRANTIES OF  MERCHANTABILITY,
+ * FITNESS FOR  A PARTICULAR PURPOSE AND  NONINFRINGEMENT. IN NO EVENT  SHALL THE
+ * AUTHORS  OR COPYRIGHT  HOLDERS  BE  LIABLE FOR  ANY  CLAIM,  DAMAGES OR  OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF  CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE  OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+#include <QJsonObject>
+
+#include <optional>
+
+#include "common/Word.hpp"
+#include "util/Result.hpp"
+#include "util/Error.hpp"
+
+namespace grunwald {
+    using ParserError = Error;
+
+    /*
+     * Maps one line of a Wiktextract JSONL dump into Word. Fields are rendered
+     * as the same HTML fragments WordParser extracts from Wiktionary pages.
+     * Entries of other languages are skipped with an empty optional.
+     */
+    class WiktextractParser final {
+    public:
+        auto parseEntry(const QByteArray& line) const -> Result<std::optional<Word>, ParserError>;
+
+    private:
+        auto parseTranscription(const QJsonObject& entry) const -> QString;
+        auto parseTranslation(const QJsonObject& entry) const -> QString;
+        auto parseType(const QJsonObject& entry) const -> WordType;
+        auto parseDescription(const QJsonObject& entry) const -> QString;
+        auto parseAssociation(const QJsonObject& entry) const -> QString;
+    };
+}
@@ -0,0 +1,80 @@
+/*
+ * Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+ * SPDX-License-Identifier: MIT
+ * Copyright (c) 2023-2025 https://github.com/klappdev
+ *
+ * Permission is hereby  granted, free of charge, to any  person obtaining a copy
+ * of this software and associated  documentation files (the "Software"), to deal
+ * in the Software  without restriction, including without  limitation the rights
+ * to  use, copy,  modify, merge,  publish, distribute,  sublicense, and/or  sell
+ * copies  of  the Software,  and  to  permit persons  to  whom  the Software  is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE  IS PROVIDED "AS  IS", WITHOUT WARRANTY  OF ANY KIND,  EXPRESS OR
+ * IMPLIED,  INCLUDING BUT  NOT  LIMITED TO  THE  WARRANTIES OF  MERCHANTABILITY,
+ * FITNESS FOR  A PARTICULAR PURPOSE AND  NONINFRINGEMENT. IN NO EVENT  SHALL THE
+ * AUTHORS  OR COPYRIGHT  HOLDERS  BE  LIABLE FOR  ANY  CLAIM,  DAMAGES OR  OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF  CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE  OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+#include <QFile>
+#include <QFuture>
+#include <QVector>
+
+#include "db/WordDao.hpp"
+#include "import/WiktextractParser.hpp"
+
+namespace grunwald {
+    using ImportError = Error;
+
+    /*
+     * Streams a Wiktextract JSONL dump into WordDao. Lines are read in bounded
+     * chunks, a chunk is parsed on the global thread pool while the previous
+     * one is written in a single transaction, so memory doesn't depend on the
+     * dump size. After every committed chunk the file offset is saved into
+     * `<dump>.checkpoint`, an interrupted import continues from there.
+     */
+    class WordImporter final {
+    public:
+        struct Stats final {
+            qint64 entries;
+            qint64 imported;
+            qint64 skipped;
+            qint64 failed;
+            qint64 elapsedMs;
+
+            auto entriesPerSecond() const -> double {
+                return elapsedMs > 0 ? entries * 1000.0 / elapsedMs : 0.0;
+            }
+        };
+
+        explicit WordImporter(WordDao& wordDao);
+
+        auto run(const QString& dumpFileName) -> Result<Stats, ImportError>;
+
+    private:
+        struct Chunk final {
+            QVector<QByteArray> lines;
+            qint64 endOffset;
+        };
+
+        using ParsedEntry = Result<std::optional<Word>, ParserError>;
+
+        auto readChunk(QFile& dumpFile) -> Chunk;
+        auto parseChunk(const Chunk& chunk) -> QFuture<ParsedEntry>;
+        auto writeChunk(const QList<ParsedEntry>& entries, Stats& stats) -> Result<void, ImportError>;
+
+        auto loadCheckpoint(const QString& dumpFileName, qint64 dumpSize, Stats& stats) -> qint64;
+        void saveCheckpoint(const QString& dumpFileName, qint64 dumpSize, qint64 offset, const Stats& stats);
+
+        WordDao& mWordDao;
+        WiktextractParser mParser;
+    };
+}
@@ -30,11 +30,13 @@
 #include <QList>
 
 #include "common/Word.hpp"
+#include "storage/WordStorage.hpp"
 
 namespace grunwald {
 
     class WordModel : public QAbstractListModel {
         Q_OBJECT
+        Q_PROPERTY(grunwald::WordStorage* storage READ storage WRITE setStorage NOTIFY storageChanged)
     public:
         explicit WordModel(QObject* parent = nullptr);
         ~WordModel();
@@ -44,12 +46,21 @@ namespace grunwald {
 
         QHash<int, QByteArray> roleNames() const override;
 
+        bool canFetchMore(const QModelIndex& parent) const override;
+        void fetchMore(const QModelIndex& parent) override;
+
+        WordStorage* storage() const;
+        void setStorage(WordStorage* storage);
+
         Q_INVOKABLE void storeWord(const Word& word);
-        Q_INVOKABLE void storeWords(const QList<Word>& list);
+        Q_INVOKABLE void storeWords(const QList<Word>& list, bool hasMore = false);
 
         Q_INVOKABLE void removeWord(int index);
         Q_INVOKABLE Word getWord(int index) const;
 
+    signals:
+        void storageChanged();
+
     private:
         enum WordRoles {
             NameRole = Qt::UserRole + 1,
@@ -63,6 +74,14 @@ namespace grunwald {
         };
 
         QList<Word> mWords;
+        WordStorage* mStorage;
+        bool mHasMoreWords;
+        bool mFetchingWords;
+
+        /*
+         * Changed on every model reset, so a page requested before the reset is dropped.
+         */
+        quint64 mGeneration;
 
         const static Word EMPTY_WORD;
     };
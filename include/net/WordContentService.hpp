@@ -47,15 +47,26 @@ namespace grunwald {
 
         void fetchWordContent(const QString& name);
 
+        /*
+         * Same request without the blocking connection check, for background
+         * callers: an unreachable server only ends in an error signal.
+         * The reply may be aborted by the caller until it finishes.
+         */
+        auto prefetchWordContent(const QString& name) -> QNetworkReply*;
+
     signals:
         void wordContentProcessed(const Word& word);
 
-        void wordContentErrorProcessed(const QString& error);
+        void wordContentErrorProcessed(const QString& name, const QString& error);
 
-    private slots:
-        void onWordContentRequestFinished();
+        /*
+         * Remote dictionary answered, but has no such word: reason is a ParserErrorCode.
+         */
+        void wordContentMissed(const QString& name, qint32 reason, const QString& error);
 
     private:
+        auto sendRequest(const QString& name) -> QNetworkReply*;
+        void onWordContentRequestFinished(QNetworkReply* reply, const QString& name);
         bool checkInternetConnection();
 
         QNetworkAccessManager mNetworkManager;
@@ -63,6 +74,5 @@ namespace grunwald {
         QNetworkConfigurationManager mNetworkConfigurationManager;
 #endif
         WordParser mWordParser;
-        QString mWordName;
     };
 }
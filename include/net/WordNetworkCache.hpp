@@ -0,0 +1,67 @@
+/*
+ * Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+ * SPDX-License-Identifier: MIT
+ * Copyright (c) 2023-2025 https://github.com/klappdev
+ *
+ * Permission is hereby  granted, free of charge, to any  person obtaining a copy
+ * of this software and associated  documentation files (the "Software"), to deal
+ * in the Software  without restriction, including without  limitation the rights
+ * to  use, copy,  modify, merge,  publish, distribute,  sublicense, and/or  sell
+ * copies  of  the Software,  and  to  permit persons  to  whom  the Software  is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE  IS PROVIDED "AS  IS", WITHOUT WARRANTY  OF ANY KIND,  EXPRESS OR
+ * IMPLIED,  INCLUDING BUT  NOT  LIMITED TO  THE  WARRANTIES OF  MERCHANTABILITY,
+ * FITNESS FOR  A PARTICULAR PURPOSE AND  NONINFRINGEMENT. IN NO EVENT  SHALL THE
+ * AUTHORS  OR COPYRIGHT  HOLDERS  BE  LIABLE FOR  ANY  CLAIM,  DAMAGES OR  OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF  CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE  OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+#include <QAbstractNetworkCache>
+
+namespace grunwald {
+
+    /*
+     * HTTP cache of Wiktionary responses and images. Every QNetworkAccessManager
+     * gets its own instance, all of them front one size-bounded QNetworkDiskCache,
+     * calls are serialized because managers live on different threads.
+     * Stale entries with ETag or Last-Modified are revalidated by the manager
+     * with a conditional request, an unchanged page comes back as 304.
+     */
+    class WordNetworkCache final : public QAbstractNetworkCache {
+        Q_OBJECT
+    public:
+        static constexpr qint64 MAX_CACHE_SIZE = 64 * 1024 * 1024;
+
+        struct Stats final {
+            qint64 hits;         // responses served from the disk cache
+            qint64 misses;       // cacheable responses downloaded in full
+            qint64 revalidated;  // cached entries confirmed by 304
+            qint64 stored;       // responses written into the disk cache
+        };
+
+        explicit WordNetworkCache(QObject* parent = nullptr);
+        ~WordNetworkCache();
+
+        static auto stats() -> Stats;
+
+        QNetworkCacheMetaData metaData(const QUrl& url) override;
+        void updateMetaData(const QNetworkCacheMetaData& metaData) override;
+        QIODevice* data(const QUrl& url) override;
+        bool remove(const QUrl& url) override;
+        qint64 cacheSize() const override;
+
+        QIODevice* prepare(const QNetworkCacheMetaData& metaData) override;
+        void insert(QIODevice* device) override;
+
+    public slots:
+        void clear() override;
+    };
+}
@@ -35,6 +35,16 @@ class QGumboNode;
 namespace grunwald {
     using ParserError = Error;
 
+    /*
+     * Codes of ParserError. NotFound and LanguageNotFound are answers of the
+     * remote dictionary itself, the same request fails the same way again.
+     */
+    enum class ParserErrorCode : qint32 {
+        Malformed = -1,
+        NotFound = 1,
+        LanguageNotFound = 2
+    };
+
     class WordParser final {
     public:
         WordParser();
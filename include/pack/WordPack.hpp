@@ -0,0 +1,73 @@
+/*
+ * Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+ * SPDX-License-Identifier: MIT
+ * Copyright (c) 2023-2025 https://github.com/klappdev
+ *
+ * Permission is hereby  granted, free of charge, to any  person obtaining a copy
+ * of this software and associated  documentation files (the "Software"), to deal
+ * in the Software  without restriction, including without  limitation the rights
+ * to  use, copy,  modify, merge,  publish, distribute,  sublicense, and/or  sell
+ * copies  of  the Software,  and  to  permit persons  to  whom  the Software  is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE  IS PROVIDED "AS  IS", WITHOUT WARRANTY  OF ANY KIND,  EXPRESS OR
+ * IMPLIED,  INCLUDING BUT  NOT  LIMITED TO  THE  WARRANTIES OF  MERCHANTABILITY,
+ * FITNESS FOR  A PARTICULAR PURPOSE AND  NONINFRINGEMENT. IN NO EVENT  SHALL THE
+ * AUTHORS  OR COPYRIGHT  HOLDERS  BE  LIABLE FOR  ANY  CLAIM,  DAMAGES OR  OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF  CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE  OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+#include <QFile>
+
+#include <optional>
+
+#include "common/Word.hpp"
+#include "pack/WordPackFormat.hpp"
+#include "util/Result.hpp"
+#include "util/Error.hpp"
+
+namespace grunwald {
+    using PackError = Error;
+
+    /*
+     * Read-only dictionary pack mapped into memory. Opening only checks the
+     * header, lookups are a binary search over the mapped key table.
+     */
+    class WordPack final {
+    public:
+        WordPack() = default;
+        ~WordPack();
+
+        WordPack(const WordPack&) = delete;
+        WordPack& operator=(const WordPack&) = delete;
+
+        auto open(const QString& fileName) -> Result<void, PackError>;
+        void close();
+
+        bool isOpen() const;
+        auto size() const -> qsizetype;
+
+        auto find(const QString& name) const -> std::optional<Word>;
+
+    private:
+        auto heapString(const WordPackFormat::StringRef& ref) const -> QStringView;
+        auto compareKey(const WordPackFormat::KeyEntry& entry, QStringView key) const -> int;
+        auto prepareWord(const WordPackFormat::Record& record) const -> Word;
+
+        QFile mFile;
+        const uchar* mData = nullptr;
+        qint64 mSize = 0;
+
+        const WordPackFormat::Header* mHeader = nullptr;
+        const WordPackFormat::KeyEntry* mKeys = nullptr;
+        const WordPackFormat::Record* mRecords = nullptr;
+        const uchar* mHeap = nullptr;
+    };
+}
@@ -0,0 +1,101 @@
+/*
+ * Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+ * SPDX-License-Identifier: MIT
+ * Copyright (c) 2023-2025 https://github.com/klappdev
+ *
+ * Permission is hereby  granted, free of charge, to any  person obtaining a copy
+ * of this software and associated  documentation files (the "Software"), to deal
+ * in the Software  without restriction, including without  limitation the rights
+ * to  use, copy,  modify, merge,  publish, distribute,  sublicense, and/or  sell
+ * copies  of  the Software,  and  to  permit persons  to  whom  the Software  is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE  IS PROVIDED "AS  IS", WITHOUT WARRANTY  OF ANY KIND,  EXPRESS OR
+ * IMPLIED,  INCLUDING BUT  NOT  LIMITED TO  THE  WARRANTIES OF  MERCHANTABILITY,
+ * FITNESS FOR  A PARTICULAR PURPOSE AND  NONINFRINGEMENT. IN NO EVENT  SHALL THE
+ * AUTHORS  OR COPYRIGHT  HOLDERS  BE  LIABLE FOR  ANY  CLAIM,  DAMAGES OR  OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF  CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE  OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+#include <QtGlobal>
+
+#include <array>
+#include <type_traits>
+
+namespace grunwald::WordPackFormat {
+
+    /*
+     * Dictionary pack layout, all values little-endian and naturally aligned:
+     *
+     *   Header
+     *   KeyEntry[wordCount]   sorted by folded headword key
+     *   Record[wordCount]     fixed-width, referenced by KeyEntry::recordIndex
+     *   heap                  UTF-16 strings addressed by StringRef
+     *
+     * The file is mapped as is, readers cast these structs over the mapping.
+     */
+    static_assert(Q_BYTE_ORDER == Q_LITTLE_ENDIAN, "Dictionary pack is mapped without byte swapping");
+
+    inline constexpr std::array<char, 8> MAGIC = { 'G', 'R', 'W', 'P', 'A', 'C', 'K', '\0' };
+    inline constexpr quint32 VERSION = 1;
+
+    /*
+     * Key units kept inline in KeyEntry, most comparisons of the
+     * binary search finish without touching the heap.
+     */
+    inline constexpr qsizetype KEY_PREFIX_SIZE = 4;
+
+    struct StringRef final {
+        quint32 offset;  // in bytes from the heap start
+        quint32 length;  // in UTF-16 code units
+    };
+
+    struct Header final {
+        std::array<char, 8> magic;
+        quint32 version;
+        quint32 wordCount;
+        quint64 keyTableOffset;
+        quint64 recordTableOffset;
+        quint64 heapOffset;
+        quint64 heapSize;
+    };
+
+    struct KeyEntry final {
+        std::array<char16_t, KEY_PREFIX_SIZE> prefix;
+        StringRef key;
+        quint32 recordIndex;
+        quint32 reserved;
+    };
+
+    enum class Field : std::size_t {
+        Name,
+        Transcription,
+        Translation,
+        Association,
+        Etymology,
+        Description,
+        ImageUrl,
+
+        Count
+    };
+
+    struct Record final {
+        std::array<StringRef, static_cast<std::size_t>(Field::Count)> fields;
+        qint32 type;
+        qint32 imageWidth;
+        qint32 imageHeight;
+        qint32 reserved;
+        qint64 date;  // msecs since epoch, -1 when unknown
+    };
+
+    static_assert(std::is_trivially_copyable_v<Header> && sizeof(Header) == 48);
+    static_assert(std::is_trivially_copyable_v<KeyEntry> && sizeof(KeyEntry) == 24);
+    static_assert(std::is_trivially_copyable_v<Record> && sizeof(Record) == 80);
+}
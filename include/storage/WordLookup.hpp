@@ -0,0 +1,109 @@
+/*
+ * Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+ * SPDX-License-Identifier: MIT
+ * Copyright (c) 2023-2025 https://github.com/klappdev
+ *
+ * Permission is hereby  granted, free of charge, to any  person obtaining a copy
+ * of this software and associated  documentation files (the "Software"), to deal
+ * in the Software  without restriction, including without  limitation the rights
+ * to  use, copy,  modify, merge,  publish, distribute,  sublicense, and/or  sell
+ * copies  of  the Software,  and  to  permit persons  to  whom  the Software  is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE  IS PROVIDED "AS  IS", WITHOUT WARRANTY  OF ANY KIND,  EXPRESS OR
+ * IMPLIED,  INCLUDING BUT  NOT  LIMITED TO  THE  WARRANTIES OF  MERCHANTABILITY,
+ * FITNESS FOR  A PARTICULAR PURPOSE AND  NONINFRINGEMENT. IN NO EVENT  SHALL THE
+ * AUTHORS  OR COPYRIGHT  HOLDERS  BE  LIABLE FOR  ANY  CLAIM,  DAMAGES OR  OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF  CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE  OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+#include <QCache>
+#include <QElapsedTimer>
+#include <QFuture>
+
+#include "cache/WordCache.hpp"
+#include "db/AsyncWordDao.hpp"
+#include "pack/WordPack.hpp"
+#include "storage/WordWriteQueue.hpp"
+#include "util/LatencyHistogram.hpp"
+
+namespace grunwald {
+
+    /*
+     * Read-through lookup over the local tiers, fastest first:
+     *
+     *   Memory    keyed WordCache, bounded by its byte budget
+     *   Database  SQLite through AsyncWordDao, queued writes included
+     *   Pack      read-only dictionary pack
+     *
+     * Origin (Wiktionary) answers are admitted through admit().
+     *
+     * Admission into memory: origin answers and saved words at once, database
+     * rows on their second hit within the last PROMOTION_CANDIDATES lookups,
+     * so a one-off read doesn't push hot words out. Pack words are never
+     * admitted, the mapped pack is as fast as memory.
+     */
+    class WordLookup final : public QObject {
+        Q_OBJECT
+    public:
+        enum class Tier {
+            Memory,
+            Database,
+            Pack,
+            Origin,
+
+            Count
+        };
+        Q_ENUM(Tier)
+
+        /*
+         * Prefetch lookups leave latency histograms and promotion to user searches.
+         */
+        enum class Source {
+            User,
+            Prefetch
+        };
+
+        struct Hit final {
+            Word word;
+            Tier tier;
+        };
+
+        static constexpr qsizetype PROMOTION_CANDIDATES = 512;
+
+        WordLookup(WordCache* wordCache, AsyncWordDao* wordDao, WordWriteQueue* writeQueue, QObject* parent = nullptr);
+        ~WordLookup();
+
+        auto open(const QString& packFileName) -> Result<void, PackError>;
+
+        /*
+         * Empty optional when no local tier has the word.
+         */
+        auto lookup(const QString& name, Source source = Source::User) -> QFuture<Result<std::optional<Hit>, DbError>>;
+
+        void admit(const Word& word, Tier source);
+        void invalidate(const QString& name);
+
+        void recordLatency(Tier tier, qint64 nsecs);
+        auto latency(Tier tier) const -> const LatencyHistogram&;
+
+    private:
+        auto lookupPack(const QString& name, Source source) -> std::optional<Hit>;
+        void promote(const Word& word);
+
+        WordCache* mWordCache;
+        AsyncWordDao* mWordDao;
+        WordWriteQueue* mWriteQueue;
+        WordPack mWordPack;
+
+        QCache<QString, bool> mPromotionCandidates;
+        std::array<LatencyHistogram, static_cast<std::size_t>(Tier::Count)> mLatencies;
+    };
+}
@@ -0,0 +1,135 @@
+/*
+ * Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+ * SPDX-License-Identifier: MIT
+ * Copyright (c) 2023-2025 https://github.com/klappdev
+ *
+ * Permission is hereby  granted, free of charge, to any  person obtaining a copy
+ * of this software and associated  documentation files (the "Software"), to deal
+ * in the Software  without restriction, including without  limitation the rights
+ * to  use, copy,  modify, merge,  publish, distribute,  sublicense, and/or  sell
+ * copies  of  the Software,  and  to  permit persons  to  whom  the Software  is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE  IS PROVIDED "AS  IS", WITHOUT WARRANTY  OF ANY KIND,  EXPRESS OR
+ * IMPLIED,  INCLUDING BUT  NOT  LIMITED TO  THE  WARRANTIES OF  MERCHANTABILITY,
+ * FITNESS FOR  A PARTICULAR PURPOSE AND  NONINFRINGEMENT. IN NO EVENT  SHALL THE
+ * AUTHORS  OR COPYRIGHT  HOLDERS  BE  LIABLE FOR  ANY  CLAIM,  DAMAGES OR  OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF  CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE  OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+#include <QCache>
+#include <QElapsedTimer>
+#include <QNetworkReply>
+#include <QPointer>
+#include <QQueue>
+#include <QSet>
+#include <QTimer>
+
+#include "db/AsyncWordDao.hpp"
+#include "net/WordContentService.hpp"
+#include "storage/WordLookup.hpp"
+#include "storage/WordSuggestionIndex.hpp"
+
+namespace grunwald {
+
+    /*
+     * Warms the memory tier while the user is typing. Once the prefix rests
+     * for DEBOUNCE_MS, the top candidates from recent history and saved
+     * headwords are looked up one at a time, PREFETCH_INTERVAL_MS apart.
+     * A new prefix drops whatever of the previous one is still queued.
+     *
+     * Only history candidates missing locally and not remembered as missed
+     * online go to Wiktionary, at most one request per NETWORK_INTERVAL_MS and
+     * NETWORK_BUDGET_PER_MINUTE a minute. Requests still in flight when the
+     * prefix changes are aborted.
+     */
+    class WordPrefetcher final : public QObject {
+        Q_OBJECT
+    public:
+        static constexpr qint32 DEBOUNCE_MS = 150;
+        static constexpr qint32 PREFETCH_INTERVAL_MS = 50;
+        static constexpr qsizetype MIN_PREFIX_SIZE = 2;
+        static constexpr qsizetype TOP_CANDIDATES = 3;
+        static constexpr qsizetype HISTORY_SIZE = 64;
+
+        static constexpr qint64 NETWORK_INTERVAL_MS = 1000;
+        static constexpr qsizetype NETWORK_BUDGET_PER_MINUTE = 20;
+
+        struct Stats final {
+            qint64 localPrefetches;
+            qint64 networkPrefetches;
+            qint64 usefulPrefetches;
+        };
+
+        WordPrefetcher(WordLookup* wordLookup, AsyncWordDao* wordDao, const WordSuggestionIndex* suggestionIndex,
+                       QObject* parent = nullptr);
+        ~WordPrefetcher();
+
+        WordPrefetcher(const WordPrefetcher&) = delete;
+        WordPrefetcher& operator=(const WordPrefetcher&) = delete;
+
+        void updatePrefix(const QString& prefix);
+
+        /*
+         * Word the user actually opened, preferred over other completions.
+         */
+        void recordHistory(const QString& name);
+
+        /*
+         * Counts a prefetch as useful when the user looks the word up afterwards.
+         */
+        void recordLookup(const QString& name);
+
+        auto stats() const -> Stats;
+
+    signals:
+        /*
+         * Wiktionary has no such word, reason is a ParserErrorCode.
+         */
+        void wordMissed(const QString& name, qint32 reason);
+
+    private slots:
+        void onDebounceFinished();
+        void onWordContentProcessFinished(const Word& word);
+        void onWordContentMissed(const QString& name, qint32 reason);
+
+    private:
+        struct Candidate final {
+            QString name;
+            bool fromHistory;
+        };
+
+        auto predict(const QString& prefix) const -> QVector<Candidate>;
+        void prefetchNext();
+        void prefetchOnline(const QString& name, quint64 generation);
+        auto acquireNetworkBudget() -> bool;
+
+        WordLookup* mWordLookup;
+        AsyncWordDao* mWordDao;
+        const WordSuggestionIndex* mSuggestionIndex;
+        WordContentService mWordContentService;
+
+        QTimer mDebounceTimer;
+        QTimer mPrefetchTimer;
+        QString mPrefix;
+        quint64 mGeneration;
+
+        QQueue<Candidate> mQueue;
+        QStringList mHistory;
+        QCache<QString, bool> mPrefetchedKeys;
+        QSet<QString> mOnlineKeys;  // requested online for the current prefix
+        QList<QPointer<QNetworkReply>> mOnlineReplies;
+
+        QElapsedTimer mNetworkClock;
+        QQueue<qint64> mNetworkRequests;
+
+        Stats mStats;
+    };
+}
@@ -25,8 +25,14 @@
 #pragma once
 
 #include "cache/WordCache.hpp"
-#include "db/WordDao.hpp"
+#include "db/AsyncWordDao.hpp"
+#include "db/WordMaintenance.hpp"
+#include "image/WordImageCache.hpp"
+#include "storage/WordSuggestionIndex.hpp"
+#include "storage/WordWriteQueue.hpp"
 #include "net/WordContentService.hpp"
+#include "storage/WordLookup.hpp"
+#include "storage/WordPrefetcher.hpp"
 
 namespace grunwald {
 
@@ -34,34 +40,76 @@ namespace grunwald {
         Q_OBJECT
         Q_PROPERTY(bool wordCached READ isWordCached NOTIFY wordCachedChanged)
     public:
-        WordStorage(WordCache* wordCache);
+        static constexpr qint32 WORDS_PAGE_SIZE = 50;
+
+        WordStorage(WordCache* wordCache, WordImageCache* imageCache,
+                    WordWriteQueue::Durability durability = WordWriteQueue::Durability::Batched);
         ~WordStorage();
 
         Q_INVOKABLE void preloadWords();
         Q_INVOKABLE void searchWord(const QString& name);
+        Q_INVOKABLE void searchWordOnline(const QString& name);
+        Q_INVOKABLE void prefetchWords(const QString& prefix);
+        Q_INVOKABLE void fullTextSearch(const QString& text, qint32 limit = 50);
 
         Q_INVOKABLE void insertWord();
         Q_INVOKABLE void removeWord();
 
+        /*
+         * Current word is saved in the database, the detail view offers to remove it instead of saving.
+         */
         bool isWordCached() const;
 
+        auto loadWordImage(qint64 imageId, const QSize& scaledSize) -> QFuture<Result<QImage, DbError>>;
+        auto loadWordsPage(const QString& afterName, qint64 afterId) -> QFuture<Result<QVector<Word>, DbError>>;
+
     signals:
         void wordContentHandled(const Word& word);
-        void localWordsHandled(const QVariant& words);
+        void localWordsHandled(const QVariant& words, bool hasMore);
+
+        /*
+         * Full text results don't replace the paged list of saved words.
+         */
+        void fullTextWordsHandled(const QString& text, const QVariant& words);
+
+        void wordSuggestionsHandled(const QString& name, const QStringList& suggestions);
 
         void wordErrorHandled(const QString& error);
         void wordCachedChanged();
 
     private slots:
         void onWordContentProcessFinished(const Word& searchedWord);
-        void onWordProcessErrorFinished(const QString& errorMessage);
+        void onWordProcessErrorFinished(const QString& name, const QString& errorMessage);
+        void onWordContentMissed(const QString& name, qint32 reason, const QString& errorMessage);
+        void onWordChangeFailed(const WordChange& change, const QString& error);
 
     private:
         auto prepareWords(const QList<Word>& words) -> QVariantList;
+        void suggestWord(const QString& name, quint64 generation);
+        void searchWordRemote(const QString& name, quint64 generation);
+        void fetchWordOnline(const QString& name);
+        void setWordSaved(bool saved);
+        void recordMiss(const QString& name, qint32 reason);
+        void updateWordSaved(const QString& name);
 
         WordCache* mWordCache;
+        WordImageCache* mImageCache;
+        bool mWordSaved;
+
+        /*
+         * Bumped by every search, answers of an older one are dropped.
+         * mOnlineName is the word the current search waits for online.
+         */
+        quint64 mSearchGeneration;
+        QString mOnlineName;
 
-        WordDao mWordDao;
+        AsyncWordDao mWordDao;
+        WordMaintenance mWordMaintenance;
+        WordWriteQueue mWriteQueue;
+        WordSuggestionIndex mSuggestionIndex;
+        WordLookup mWordLookup;
+        WordPrefetcher mWordPrefetcher;
         WordContentService mWordContentService;
+        QElapsedTimer mOriginTimer;
     };
 }
@@ -0,0 +1,76 @@
+/*
+ * Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+ * SPDX-License-Identifier: MIT
+ * Copyright (c) 2023-2025 https://github.com/klappdev
+ *
+ * Permission is hereby  granted, free of charge, to any  person obtaining a copy
+ * of this software and associated  documentation files (the "Software"), to deal
+ * in the Software  without restriction, including without  limitation the rights
+ * to  use, copy,  modify, merge,  publish, distribute,  sublicense, and/or  sell
+ * copies  of  the Software,  and  to  permit persons  to  whom  the Software  is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE  IS PROVIDED "AS  IS", WITHOUT WARRANTY  OF ANY KIND,  EXPRESS OR
+ * IMPLIED,  INCLUDING BUT  NOT  LIMITED TO  THE  WARRANTIES OF  MERCHANTABILITY,
+ * FITNESS FOR  A PARTICULAR PURPOSE AND  NONINFRINGEMENT. IN NO EVENT  SHALL THE
+ * AUTHORS  OR COPYRIGHT  HOLDERS  BE  LIABLE FOR  ANY  CLAIM,  DAMAGES OR  OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF  CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE  OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+#include <QHash>
+#include <QStringList>
+#include <QVector>
+
+namespace grunwald {
+
+    /*
+     * In-memory trigram index over saved headwords. Candidates sharing enough
+     * trigrams with the query are ranked by edit distance, so misspelled
+     * lookups get "did you mean" suggestions without a network request.
+     * Entries are kept per exact headword, "Maße" and "Masse" share
+     * trigrams but are inserted and removed separately.
+     */
+    class WordSuggestionIndex final {
+    public:
+        WordSuggestionIndex() = default;
+        ~WordSuggestionIndex() = default;
+
+        void reset(const QStringList& names);
+        void insert(const QString& name);
+        void remove(const QString& name);
+
+        auto suggest(const QString& name, qsizetype limit, qint32 maxDistance) const -> QStringList;
+
+        /*
+         * Headwords starting with the prefix, shortest first.
+         */
+        auto complete(const QString& prefix, qsizetype limit) const -> QStringList;
+
+        auto size() const -> qsizetype;
+
+    private:
+        struct Entry final {
+            QString name;
+            QString key;
+            qint32 trigramCount;
+            bool removed;
+        };
+
+        void compact();
+
+        static auto prepareTrigrams(const QString& key) -> QVector<quint64>;
+        static auto editDistance(QStringView left, QStringView right, qint32 maxDistance) -> qint32;
+
+        QVector<Entry> mEntries;
+        QHash<QString, qint32> mEntryIndexes;
+        QHash<QString, qint32> mRemovedIndexes;
+        QHash<quint64, QVector<qint32>> mPostings;
+    };
+}
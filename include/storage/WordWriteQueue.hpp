@@ -0,0 +1,76 @@
+/*
+ * Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+ * SPDX-License-Identifier: MIT
+ * Copyright (c) 2023-2025 https://github.com/klappdev
+ *
+ * Permission is hereby  granted, free of charge, to any  person obtaining a copy
+ * of this software and associated  documentation files (the "Software"), to deal
+ * in the Software  without restriction, including without  limitation the rights
+ * to  use, copy,  modify, merge,  publish, distribute,  sublicense, and/or  sell
+ * copies  of  the Software,  and  to  permit persons  to  whom  the Software  is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE  IS PROVIDED "AS  IS", WITHOUT WARRANTY  OF ANY KIND,  EXPRESS OR
+ * IMPLIED,  INCLUDING BUT  NOT  LIMITED TO  THE  WARRANTIES OF  MERCHANTABILITY,
+ * FITNESS FOR  A PARTICULAR PURPOSE AND  NONINFRINGEMENT. IN NO EVENT  SHALL THE
+ * AUTHORS  OR COPYRIGHT  HOLDERS  BE  LIABLE FOR  ANY  CLAIM,  DAMAGES OR  OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF  CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE  OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+#include <QTimer>
+
+#include "db/AsyncWordDao.hpp"
+
+namespace grunwald {
+
+    /*
+     * Write-behind journal for saved words. Changes are queued at once and
+     * the latest change per headword wins, queued changes are committed in
+     * one transaction when the flush interval passes or the queue fills up.
+     */
+    class WordWriteQueue final : public QObject {
+        Q_OBJECT
+    public:
+        enum class Durability {
+            Immediate,  // every change is committed on its own right away
+            Batched     // changes wait up to FLUSH_INTERVAL_MS and commit together
+        };
+
+        static constexpr qint32 FLUSH_INTERVAL_MS = 250;
+        static constexpr qsizetype FLUSH_CHANGES = 32;
+
+        explicit WordWriteQueue(AsyncWordDao* wordDao, Durability durability = Durability::Batched, QObject* parent = nullptr);
+        ~WordWriteQueue();
+
+        WordWriteQueue(const WordWriteQueue&) = delete;
+        WordWriteQueue& operator=(WordWriteQueue&) = delete;
+
+        void enqueue(const WordChange& change);
+
+        /*
+         * Queued change for the exact headword, not yet handed to the database thread.
+         * Changes already handed over are ordered before any later read.
+         */
+        auto pendingChange(const QString& name) const -> const WordChange*;
+
+        auto flush() -> QFuture<void>;
+
+    signals:
+        void changeFailed(const WordChange& change, const QString& error);
+
+    private:
+        AsyncWordDao* mWordDao;
+        Durability mDurability;
+
+        QTimer mFlushTimer;
+        QVector<WordChange> mChanges;
+        QHash<QString, qsizetype> mChangeIndexes;
+    };
+}
@@ -0,0 +1,77 @@
+/*
+ * Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+ * SPDX-License-Identifier: MIT
+ * Copyright (c) 2023-2025 https://github.com/klappdev
+ *
+ * Permission is hereby  granted, free of charge, to any  person obtaining a copy
+ * of this software and associated  documentation files (the "Software"), to deal
+ * in the Software  without restriction, including without  limitation the rights
+ * to  use, copy,  modify, merge,  publish, distribute,  sublicense, and/or  sell
+ * copies  of  the Software,  and  to  permit persons  to  whom  the Software  is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE  IS PROVIDED "AS  IS", WITHOUT WARRANTY  OF ANY KIND,  EXPRESS OR
+ * IMPLIED,  INCLUDING BUT  NOT  LIMITED TO  THE  WARRANTIES OF  MERCHANTABILITY,
+ * FITNESS FOR  A PARTICULAR PURPOSE AND  NONINFRINGEMENT. IN NO EVENT  SHALL THE
+ * AUTHORS  OR COPYRIGHT  HOLDERS  BE  LIABLE FOR  ANY  CLAIM,  DAMAGES OR  OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF  CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE  OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+#include <QtGlobal>
+
+#include <algorithm>
+#include <array>
+#include <bit>
+
+namespace grunwald {
+
+    /*
+     * Latency histogram with power-of-two microsecond buckets: bucket i counts
+     * samples below 2^i µs, the last one takes everything slower.
+     */
+    class LatencyHistogram final {
+    public:
+        static constexpr qsizetype BUCKET_COUNT = 24;
+
+        void record(qint64 nsecs) {
+            const auto usecs = static_cast<quint64>(std::max<qint64>(nsecs / 1000, 0));
+            const auto bucket = std::min<qsizetype>(std::bit_width(usecs), BUCKET_COUNT - 1);
+
+            ++mBuckets[static_cast<std::size_t>(bucket)];
+            ++mCount;
+        }
+
+        auto count() const -> qint64 {
+            return mCount;
+        }
+
+        /*
+         * Upper bound in µs of the bucket holding the given percentile, 0 without samples.
+         */
+        auto percentile(double value) const -> qint64 {
+            const auto rank = static_cast<qint64>(value / 100.0 * static_cast<double>(mCount));
+            qint64 seen = 0;
+
+            for (qsizetype i = 0; i < BUCKET_COUNT && mCount > 0; ++i) {
+                seen += mBuckets[static_cast<std::size_t>(i)];
+
+                if (seen > rank || seen == mCount) {
+                    return qint64{1} << i;
+                }
+            }
+
+            return 0;
+        }
+
+    private:
+        std::array<qint64, BUCKET_COUNT> mBuckets {};
+        qint64 mCount = 0;
+    };
+}
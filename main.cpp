@@ -42,14 +42,15 @@ int main(int argc, char *argv[]) {
     app.setWindowIcon(QIcon(":/res/image/dict.png"));
 
     QScopedPointer<grunwald::WordCache> wordCache(new grunwald::WordCache{});
-    QScopedPointer<grunwald::WordStorage> wordStorage(new grunwald::WordStorage{wordCache.get()});
+    QScopedPointer<grunwald::WordImageCache> imageCache(new grunwald::WordImageCache{});
+    QScopedPointer<grunwald::WordStorage> wordStorage(new grunwald::WordStorage{wordCache.get(), imageCache.get()});
 
     qmlRegisterSingletonInstance("grunwald.WordStorage", 1, 0, "WordStorage", wordStorage.get());
     qmlRegisterType<grunwald::WordModel>("grunwald.WordModel", 1, 0, "WordModel");
     qmlRegisterType<grunwald::Word>("grunwald.Word", 1, 0, "remoteWord");
 
     QQmlApplicationEngine engine;
-    engine.addImageProvider(QStringLiteral("grunwald"), new grunwald::AsyncWordImageProvider{wordCache.get()});
+    engine.addImageProvider(QStringLiteral("grunwald"), new grunwald::AsyncWordImageProvider{wordCache.get(), imageCache.get(), wordStorage.get()});
     engine.addImportPath(":/qml");
     engine.load(QUrl(QStringLiteral("qrc:/qml/main.qml")));
 
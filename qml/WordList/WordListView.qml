@@ -47,11 +47,11 @@ ListView {
             wordListView.selectedWord = word
         })
 
-        WordStorage.localWordsHandled.connect(function(wordArray) {
+        WordStorage.localWordsHandled.connect(function(wordArray, hasMore) {
             console.log(`Search words: ${wordArray.length}`)
 
             if (wordArray.length !== 0) {
-                wordModel.storeWords(wordArray)
+                wordModel.storeWords(wordArray, hasMore)
 
                 wordListView.selectedWord = wordArray[0]
             }
@@ -64,6 +64,7 @@ ListView {
 
     WordModel {
         id: wordModel
+        storage: WordStorage
     }
     model: wordModel
 
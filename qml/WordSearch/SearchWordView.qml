@@ -56,6 +56,74 @@ Rectangle {
 
             console.log(message)
         })
+
+        WordStorage.wordSuggestionsHandled.connect(function(name, suggestions) {
+            suggestionPopup.searchedName = name
+            suggestionPopup.suggestions = suggestions
+            suggestionPopup.open()
+
+            console.info(`Word ${name} isn't saved, suggestions: ${suggestions}`)
+        })
+    }
+
+    Popup {
+        id: suggestionPopup
+
+        property string searchedName: ""
+        property var suggestions: []
+
+        x: searchTextEdit.x
+        y: searchTextEdit.y + searchTextEdit.height
+        width: searchTextEdit.width
+        padding: 0
+
+        contentItem: Column {
+            Label {
+                width: parent.width
+                padding: Style.mediumSpacing
+                text: qsTr("Did you mean:")
+                font {
+                    family: "Roboto Regular"
+                    pointSize: 10
+                }
+            }
+
+            Repeater {
+                model: suggestionPopup.suggestions
+
+                delegate: ItemDelegate {
+                    width: parent.width
+                    text: modelData
+                    font {
+                        family: "Roboto Regular"
+                        pointSize: 12
+                    }
+
+                    onClicked: {
+                        suggestionPopup.close()
+
+                        searchTextEdit.text = modelData
+                        WordStorage.searchWord(modelData)
+                    }
+                }
+            }
+
+            ItemDelegate {
+                width: parent.width
+                text: qsTr("Search \"%1\" online").arg(suggestionPopup.searchedName)
+                font {
+                    family: "Roboto Regular"
+                    pointSize: 12
+                    italic: true
+                }
+
+                onClicked: {
+                    suggestionPopup.close()
+
+                    WordStorage.searchWordOnline(suggestionPopup.searchedName)
+                }
+            }
+        }
     }
 
     TextField {
@@ -88,6 +156,10 @@ Rectangle {
                 width: 1
             }
         }
+
+        onTextEdited: {
+            WordStorage.prefetchWords(text)
+        }
     }
 
     Button {
@@ -21,11 +21,21 @@
  * OUT OF OR IN CONNECTION WITH THE SOFTWARE  OR THE USE OR OTHER DEALINGS IN THE
  * SOFTWARE.
  */
-
 #include "cache/WordCache.hpp"
 
+#include <algorithm>
+
 namespace {
     constexpr const char* const TAG = "[WordCache] ";
+
+    auto payloadSize(const QString& key, const grunwald::Word& word) -> qint64 {
+        const qsizetype units = key.size() + word.name.size() + word.transcription.size() +
+                                word.translation.size() + word.association.size() +
+                                word.etymology.size() + word.description.size() +
+                                word.image.url.toString().size();
+
+        return static_cast<qint64>(sizeof(grunwald::Word) + units * sizeof(QChar) + word.image.data.size());
+    }
 }
 
 namespace grunwald {
@@ -43,59 +53,207 @@ namespace grunwald {
         .date = QDateTime{}
     };
 
-    WordCache::WordCache() : mData(new Word{EMPTY_WORD}) {
+    WordCache::WordCache(qint64 byteBudget)
+        : mData(nullptr)
+        , mGeneration(0)
+        , mShardBudget(std::max<qint64>(byteBudget / SHARD_COUNT, 1)) {
     }
 
     WordCache::~WordCache() {
-        auto* data = mData.loadAcquire();
+        const Stats cacheStats = stats();
 
-        if (data != nullptr) {
-            delete mData;
-        }
+        qInfo() << TAG << "Hits: " << cacheStats.hits << ", misses: " << cacheStats.misses
+                << ", evictions: " << cacheStats.evictions << Qt::endl;
     }
 
     bool WordCache::isValid() const {
-        return loadWordContent() == EMPTY_WORD;
+        return (mGeneration.load(std::memory_order_acquire) & 1) != 0;
+    }
+
+    auto WordCache::generation() const -> quint64 {
+        return mGeneration.load(std::memory_order_acquire) >> 1;
     }
 
     void WordCache::clear() {
-        storeWordContent(EMPTY_WORD);
+        publish(nullptr);
     }
 
     void WordCache::storeWordContent(const Word& word) {
-        auto* atomicData = mData.loadAcquire();
-        *atomicData = word;
-
-        mData.storeRelease(atomicData);
+        publish(std::make_shared<const Word>(word));
     }
 
-    void WordCache::storeWordImage(const WordImage& wordImage) {
-        auto* atomicData = mData.loadAcquire();
-        atomicData->image = wordImage;
+    void WordCache::storeWordImage(const QString& name, const WordImage& wordImage) {
+        {
+            QMutexLocker locker(&mPublishMutex);
 
-        mData.storeRelease(atomicData);
+            const std::shared_ptr<const Word> snapshot = mData.load(std::memory_order_acquire);
+
+            /*
+             * A different current word means the image belongs to an old selection.
+             */
+            if (snapshot != nullptr && snapshot->name == name) {
+                auto updatedWord = std::make_shared<Word>(*snapshot);
+                updatedWord->image = wordImage;
+
+                mData.store(std::move(updatedWord), std::memory_order_release);
+                mGeneration.fetch_add(2, std::memory_order_acq_rel);
+            }
+        }
+
+        Shard& keyShard = shard(name);
+
+        QMutexLocker locker(&keyShard.mutex);
+
+        if (auto it = keyShard.keys.find(name); it != keyShard.keys.end()) {
+            Word word = it.value()->word;
+            word.image = wordImage;
+
+            store(keyShard, name, word);
+        }
     }
 
     auto WordCache::loadWordContent() const -> Word {
-        auto* atomicData = mData.loadAcquire();
+        const std::shared_ptr<const Word> snapshot = loadSnapshot();
 
-        if (atomicData == nullptr) {
-            qWarning() << TAG << "Cached data is NULL!" << Qt::endl;
-            return {};
+        return snapshot != nullptr ? *snapshot : EMPTY_WORD;
+    }
+
+    auto WordCache::loadSnapshot() const -> std::shared_ptr<const Word> {
+        return mData.load(std::memory_order_acquire);
+    }
+
+    void WordCache::publish(std::shared_ptr<const Word> snapshot) {
+        QMutexLocker locker(&mPublishMutex);
+
+        const quint64 hasWord = snapshot != nullptr ? 1 : 0;
+        const quint64 generation = mGeneration.load(std::memory_order_relaxed);
+
+        mData.store(std::move(snapshot), std::memory_order_release);
+        mGeneration.store(((generation >> 1) + 1) << 1 | hasWord, std::memory_order_release);
+    }
+
+    void WordCache::insert(const Word& word) {
+        if (word.name.isEmpty()) {
+            return;
         }
 
-        return *atomicData;
+        Shard& keyShard = shard(word.name);
+
+        QMutexLocker locker(&keyShard.mutex);
+
+        store(keyShard, word.name, word);
     }
 
-    auto WordCache::loadWordImage() const -> WordImage {
-        auto* atomicData = mData.loadAcquire();
+    void WordCache::remove(const QString& name) {
+        Shard& keyShard = shard(name);
 
-        if (atomicData == nullptr) {
-            qWarning() << TAG << "Cached data is NULL!" << Qt::endl;
-            return {};
+        QMutexLocker locker(&keyShard.mutex);
+
+        if (auto it = keyShard.keys.find(name); it != keyShard.keys.end()) {
+            erase(keyShard, it.value());
         }
+    }
 
-        return atomicData->image;
+    auto WordCache::find(const QString& name) -> std::optional<Word> {
+        Shard& keyShard = shard(name);
+
+        QMutexLocker locker(&keyShard.mutex);
+
+        const auto it = keyShard.keys.constFind(name);
+
+        if (it == keyShard.keys.cend()) {
+            ++keyShard.misses;
+            return std::nullopt;
+        }
+
+        ++keyShard.hits;
+        keyShard.entries.splice(keyShard.entries.begin(), keyShard.entries, it.value());
+
+        return it.value()->word;
+    }
+
+    auto WordCache::find(qint64 id) -> std::optional<Word> {
+        /*
+         * Shards are keyed by name, an id lookup probes each of them.
+         */
+        for (Shard& idShard : mShards) {
+            QMutexLocker locker(&idShard.mutex);
+
+            if (const auto it = idShard.ids.constFind(id); it != idShard.ids.cend()) {
+                ++idShard.hits;
+                idShard.entries.splice(idShard.entries.begin(), idShard.entries, it.value());
+
+                return it.value()->word;
+            }
+        }
+
+        Shard& missShard = mShards[static_cast<quint64>(id) % SHARD_COUNT];
+        QMutexLocker locker(&missShard.mutex);
+        ++missShard.misses;
+
+        return std::nullopt;
+    }
+
+    auto WordCache::stats() const -> Stats {
+        Stats cacheStats {};
+
+        for (const Shard& statsShard : mShards) {
+            QMutexLocker locker(&statsShard.mutex);
+
+            cacheStats.hits += statsShard.hits;
+            cacheStats.misses += statsShard.misses;
+            cacheStats.evictions += statsShard.evictions;
+            cacheStats.bytes += statsShard.bytes;
+            cacheStats.count += statsShard.keys.size();
+        }
+
+        return cacheStats;
+    }
+
+    auto WordCache::shard(const QString& key) -> Shard& {
+        return mShards[qHash(key) % SHARD_COUNT];
+    }
+
+    /*
+     * Charges the entry to the shard and evicts least recently used ones over budget.
+     * Called with the shard mutex held.
+     */
+    void WordCache::store(Shard& shard, QString key, const Word& word) {
+        const qint64 bytes = payloadSize(key, word);
+
+        if (auto it = shard.keys.find(key); it != shard.keys.end()) {
+            erase(shard, it.value());
+        }
+
+        /*
+         * A word larger than the whole shard budget would only flush the shard.
+         */
+        if (bytes > mShardBudget) {
+            return;
+        }
+
+        shard.entries.push_front(Entry { key, word, bytes });
+        shard.keys.insert(std::move(key), shard.entries.begin());
+        shard.bytes += bytes;
+
+        if (word.id > 0) {
+            shard.ids.insert(word.id, shard.entries.begin());
+        }
+
+        while (shard.bytes > mShardBudget) {
+            erase(shard, std::prev(shard.entries.end()));
+            ++shard.evictions;
+        }
     }
 
+    void WordCache::erase(Shard& shard, std::list<Entry>::iterator entry) {
+        shard.keys.remove(entry->key);
+
+        if (const auto it = shard.ids.constFind(entry->word.id); it != shard.ids.cend() && it.value() == entry) {
+            shard.ids.erase(it);
+        }
+
+        shard.bytes -= entry->bytes;
+        shard.entries.erase(entry);
+    }
 }
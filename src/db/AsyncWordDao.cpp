@@ -0,0 +1,233 @@
+/*
+ * Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+ * SPDX-License-Identifier: MIT
+ * Copyright (c) 2023-2025 https://github.com/klappdev
+ *
+ * Permission is hereby  granted, free of charge, to any  person obtaining a copy
+ * of this software and associated  documentation files (the "Software"), to deal
+ * in the Software  without restriction, including without  limitation the rights
+ * to  use, copy,  modify, merge,  publish, distribute,  sublicense, and/or  sell
+ * copies  of  the Software,  and  to  permit persons  to  whom  the Software  is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE  IS PROVIDED "AS  IS", WITHOUT WARRANTY  OF ANY KIND,  EXPRESS OR
+ * IMPLIED,  INCLUDING BUT  NOT  LIMITED TO  THE  WARRANTIES OF  MERCHANTABILITY,
+ * FITNESS FOR  A PARTICULAR PURPOSE AND  NONINFRINGEMENT. IN NO EVENT  SHALL THE
+ * AUTHORS  OR COPYRIGHT  HOLDERS  BE  LIABLE FOR  ANY  CLAIM,  DAMAGES OR  OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF  CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE  OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "db/AsyncWordDao.hpp"
+
+#include <QImageReader>
+
+namespace {
+    constexpr const char* const TAG = "[AsyncWordDao] ";
+    constexpr const char* const THREAD_NAME = "grunwald_db";
+    constexpr const char* const READER_POOL_NAME = "grunwald_db_reader";
+}
+
+namespace grunwald {
+
+    AsyncWordDao::AsyncWordDao(QObject* parent)
+        : QObject(parent)
+        , mContext(std::make_unique<QObject>()) {
+        mThread.setObjectName(THREAD_NAME);
+        mContext->moveToThread(&mThread);
+        mThread.start();
+
+        /*
+         * Idle readers are kept, so their pinned connections and statements aren't opened again.
+         */
+        mReaderPool.setObjectName(READER_POOL_NAME);
+        mReaderPool.setMaxThreadCount(WordDao::READER_CONNECTIONS);
+        mReaderPool.setExpiryTimeout(-1);
+
+        /*
+         * The connection has to be opened by the thread which uses it,
+         * requests queued after this one run when tables are ready.
+         */
+        auto opened = std::make_shared<QPromise<void>>();
+        opened->start();
+        mLastWrite = opened->future();
+
+        QMetaObject::invokeMethod(mContext.get(), [this, opened]() {
+            mWordDao = std::make_unique<WordDao>();
+            opened->finish();
+        }, Qt::QueuedConnection);
+
+        qInfo() << TAG << "Database thread started!" << Qt::endl;
+    }
+
+    AsyncWordDao::~AsyncWordDao() {
+        /*
+         * Queued writes finish first, reads waiting for them are in the reader pool then.
+         */
+        QMetaObject::invokeMethod(mContext.get(), []() {}, Qt::BlockingQueuedConnection);
+
+        /*
+         * Reader threads exit here, each of them closes its own connection.
+         */
+        mReaderPool.waitForDone();
+
+        QMetaObject::invokeMethod(mContext.get(), [this]() {
+            mWordDao.reset();
+        }, Qt::BlockingQueuedConnection);
+
+        mThread.quit();
+        mThread.wait();
+        mContext.reset();
+
+        qInfo() << TAG << "Database thread finished!" << Qt::endl;
+    }
+
+    auto AsyncWordDao::reset() -> QFuture<void> {
+        return submit([](WordDao& wordDao) {
+            wordDao.reset();
+        });
+    }
+
+    auto AsyncWordDao::checkIfExists(const QString& name) -> QFuture<bool> {
+        return submitRead([name](WordDao& wordDao) {
+            return wordDao.checkIfExists(name);
+        });
+    }
+
+    auto AsyncWordDao::add(const Word& word) -> QFuture<Result<void, DbError>> {
+        return submit([word](WordDao& wordDao) {
+            return wordDao.add(word);
+        });
+    }
+
+    auto AsyncWordDao::update(const Word& word) -> QFuture<Result<void, DbError>> {
+        return submit([word](WordDao& wordDao) {
+            return wordDao.update(word);
+        });
+    }
+
+    auto AsyncWordDao::remove(const Word& word) -> QFuture<Result<void, DbError>> {
+        return submit([word](WordDao& wordDao) {
+            return wordDao.remove(word);
+        });
+    }
+
+    auto AsyncWordDao::addBatch(const QVector<Word>& words) -> QFuture<QVector<Result<void, DbError>>> {
+        return submit([words](WordDao& wordDao) {
+            return wordDao.addBatch(QSpan<const Word>(words));
+        });
+    }
+
+    auto AsyncWordDao::applyBatch(const QVector<WordChange>& changes) -> QFuture<QVector<Result<void, DbError>>> {
+        return submit([changes](WordDao& wordDao) {
+            return wordDao.applyBatch(QSpan<const WordChange>(changes));
+        });
+    }
+
+    auto AsyncWordDao::updateBatch(const QVector<Word>& words) -> QFuture<QVector<Result<void, DbError>>> {
+        return submit([words](WordDao& wordDao) {
+            return wordDao.updateBatch(QSpan<const Word>(words));
+        });
+    }
+
+    auto AsyncWordDao::get(qint32 id) -> QFuture<Result<Word, DbError>> {
+        return submitRead([id](WordDao& wordDao) {
+            return wordDao.get(id);
+        });
+    }
+
+    auto AsyncWordDao::getAll() -> QFuture<Result<QVector<Word>, DbError>> {
+        return submitRead([](WordDao& wordDao) {
+            return wordDao.getAll();
+        });
+    }
+
+    auto AsyncWordDao::getNames() -> QFuture<Result<QStringList, DbError>> {
+        return submitRead([](WordDao& wordDao) {
+            return wordDao.getNames();
+        });
+    }
+
+    auto AsyncWordDao::search(const QString& name) -> QFuture<Result<QVector<Word>, DbError>> {
+        return submitRead([name](WordDao& wordDao) {
+            return wordDao.search(name);
+        });
+    }
+
+    auto AsyncWordDao::fullTextSearch(const QString& text, qint32 limit) -> QFuture<Result<QVector<Word>, DbError>> {
+        return submitRead([text, limit](WordDao& wordDao) {
+            return wordDao.fullTextSearch(text, limit);
+        });
+    }
+
+    auto AsyncWordDao::page(const QString& afterName, qint64 afterId, qint32 limit) -> QFuture<Result<QVector<Word>, DbError>> {
+        return submitRead([afterName, afterId, limit](WordDao& wordDao) {
+            return wordDao.page(afterName, afterId, limit);
+        });
+    }
+
+    auto AsyncWordDao::loadImageData(qint64 imageId) -> QFuture<Result<QByteArray, DbError>> {
+        return submitRead([imageId](WordDao& wordDao) {
+            return wordDao.loadImageData(imageId);
+        });
+    }
+
+    auto AsyncWordDao::findMiss(const QString& name) -> QFuture<Result<std::optional<WordMiss>, DbError>> {
+        return submitRead([name](WordDao& wordDao) {
+            return wordDao.findMiss(name);
+        });
+    }
+
+    auto AsyncWordDao::addMiss(const WordMiss& miss, qint32 limit) -> QFuture<Result<void, DbError>> {
+        return submit([miss, limit](WordDao& wordDao) {
+            return wordDao.addMiss(miss, limit);
+        });
+    }
+
+    auto AsyncWordDao::loadImage(qint64 imageId, const QSize& scaledSize) -> QFuture<Result<QImage, DbError>> {
+        return submitRead([imageId, scaledSize](WordDao& wordDao) -> Result<QImage, DbError> {
+            Result<std::unique_ptr<QIODevice>, DbError> stream = wordDao.openImageStream(imageId);
+
+            if (stream.hasError()) {
+                return stream.error();
+            }
+
+            QImageReader imageReader(stream.value().get());
+
+            if (scaledSize.isValid()) {
+                imageReader.setScaledSize(scaledSize);
+            }
+
+            QImage image = imageReader.read();
+
+            if (image.isNull()) {
+                qWarning() << TAG << "Decode image error: " << imageId << "," << imageReader.errorString() << Qt::endl;
+                return DbError { imageReader.errorString(), static_cast<qint32>(imageReader.error()) };
+            }
+
+            return image;
+        });
+    }
+
+    auto AsyncWordDao::optimize() -> QFuture<Result<void, DbError>> {
+        return submit([](WordDao& wordDao) {
+            return wordDao.optimize();
+        });
+    }
+
+    auto AsyncWordDao::analyze() -> QFuture<Result<void, DbError>> {
+        return submit([](WordDao& wordDao) {
+            return wordDao.analyze();
+        });
+    }
+
+    auto AsyncWordDao::incrementalVacuum(qint32 maxPages) -> QFuture<Result<WordDao::VacuumStats, DbError>> {
+        return submit([maxPages](WordDao& wordDao) {
+            return wordDao.incrementalVacuum(maxPages);
+        });
+    }
+}
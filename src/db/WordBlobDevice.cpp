@@ -0,0 +1,125 @@
+/*
+ * Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+ * SPDX-License-Identifier: MIT
+ * Copyright (c) 2023-2025 https://github.com/klappdev
+ *
+ * Permission is hereby  granted, free of charge, to any  person obtaining a copy
+ * of this software and associated  documentation files (the "Software"), to deal
+ * in the Software  without restriction, including without  limitation the rights
+ * to  use, copy,  modify, merge,  publish, distribute,  sublicense, and/or  sell
+ * copies  of  the Software,  and  to  permit persons  to  whom  the Software  is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE  IS PROVIDED "AS  IS", WITHOUT WARRANTY  OF ANY KIND,  EXPRESS OR
+ * IMPLIED,  INCLUDING BUT  NOT  LIMITED TO  THE  WARRANTIES OF  MERCHANTABILITY,
+ * FITNESS FOR  A PARTICULAR PURPOSE AND  NONINFRINGEMENT. IN NO EVENT  SHALL THE
+ * AUTHORS  OR COPYRIGHT  HOLDERS  BE  LIABLE FOR  ANY  CLAIM,  DAMAGES OR  OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF  CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE  OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "db/WordBlobDevice.hpp"
+
+#include "db/SqliteHandle.hpp"
+
+namespace {
+    constexpr const char* const TAG = "[WordBlobDevice] ";
+}
+
+namespace grunwald {
+
+    WordBlobDevice::WordBlobDevice(const QSqlDatabase& database, const QString& table, const QString& column, qint64 rowId)
+        : mHandle(sqliteHandle(database))
+        , mBlob(nullptr)
+        , mSize(0)
+        , mTable(table.toUtf8())
+        , mColumn(column.toUtf8())
+        , mRowId(rowId) {
+    }
+
+    WordBlobDevice::~WordBlobDevice() {
+        close();
+    }
+
+    bool WordBlobDevice::open(OpenMode mode) {
+        if ((mode & QIODevice::ReadWrite) != QIODevice::ReadOnly) {
+            setErrorString("Blob device supports only read mode");
+            return false;
+        }
+
+        if (mHandle == nullptr) {
+            setErrorString("Database connection hasn't SQLite handle");
+            return false;
+        }
+
+        if (sqlite3_blob_open(mHandle, "main", mTable.constData(), mColumn.constData(), mRowId, 0, &mBlob) != SQLITE_OK) {
+            setErrorString(QString::fromUtf8(sqlite3_errmsg(mHandle)));
+            qWarning() << TAG << "Open blob error: " << mRowId << "," << errorString() << Qt::endl;
+
+            sqlite3_blob_close(mBlob);
+            mBlob = nullptr;
+            return false;
+        }
+
+        mSize = sqlite3_blob_bytes(mBlob);
+
+        /*
+         * Unbuffered, so reads go straight into the caller's buffer
+         * and pos() always matches the blob offset.
+         */
+        return QIODevice::open(mode | QIODevice::Unbuffered);
+    }
+
+    void WordBlobDevice::close() {
+        if (mBlob != nullptr) {
+            sqlite3_blob_close(mBlob);
+            mBlob = nullptr;
+        }
+
+        mSize = 0;
+
+        if (isOpen()) {
+            QIODevice::close();
+        }
+    }
+
+    bool WordBlobDevice::isSequential() const {
+        return false;
+    }
+
+    qint64 WordBlobDevice::size() const {
+        return mSize;
+    }
+
+    qint64 WordBlobDevice::readData(char* data, qint64 maxSize) {
+        const qint64 offset = pos();
+        const qint64 length = qMin(maxSize, mSize - offset);
+
+        if (mBlob == nullptr || length < 0) {
+            return -1;
+        }
+
+        if (length == 0) {
+            return 0;
+        }
+
+        /*
+         * Reading fails with SQLITE_ABORT when the row was changed
+         * after the blob was opened, the device reports it as an error.
+         */
+        if (sqlite3_blob_read(mBlob, data, static_cast<int>(length), static_cast<int>(offset)) != SQLITE_OK) {
+            setErrorString(QString::fromUtf8(sqlite3_errmsg(mHandle)));
+            return -1;
+        }
+
+        return length;
+    }
+
+    qint64 WordBlobDevice::writeData(const char*, qint64) {
+        return -1;
+    }
+}
@@ -0,0 +1,278 @@
+/*
+ * Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+ * SPDX-License-Identifier: MIT
+ * Copyright (c) 2023-2025 https://github.com/klappdev
+ *
+ * Permission is hereby  granted, free of charge, to any  person obtaining a copy
+ * of this software and associated  documentation files (the "Software"), to deal
+ * in the Software  without restriction, including without  limitation the rights
+ * to  use, copy,  modify, merge,  publish, distribute,  sublicense, and/or  sell
+ * copies  of  the Software,  and  to  permit persons  to  whom  the Software  is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE  IS PROVIDED "AS  IS", WITHOUT WARRANTY  OF ANY KIND,  EXPRESS OR
+ * IMPLIED,  INCLUDING BUT  NOT  LIMITED TO  THE  WARRANTIES OF  MERCHANTABILITY,
+ * FITNESS FOR  A PARTICULAR PURPOSE AND  NONINFRINGEMENT. IN NO EVENT  SHALL THE
+ * AUTHORS  OR COPYRIGHT  HOLDERS  BE  LIABLE FOR  ANY  CLAIM,  DAMAGES OR  OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF  CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE  OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "db/WordConnectionPool.hpp"
+
+#include <QDeadlineTimer>
+
+#include <utility>
+
+namespace {
+    constexpr const char* const TAG = "[WordConnectionPool] ";
+    constexpr const char* const READER_OPTIONS = "QSQLITE_OPEN_READONLY;QSQLITE_BUSY_TIMEOUT=5000";
+}
+
+namespace grunwald {
+
+    WordConnectionPool::Lease::Lease(WordConnectionPool* pool, QThread* thread)
+        : mPool(pool)
+        , mThread(thread) {
+    }
+
+    WordConnectionPool::Lease::~Lease() {
+        if (mPool != nullptr) {
+            mPool->release(mThread);
+        }
+    }
+
+    WordConnectionPool::Lease::Lease(Lease&& other) noexcept
+        : mPool(std::exchange(other.mPool, nullptr))
+        , mThread(std::exchange(other.mThread, nullptr)) {
+    }
+
+    auto WordConnectionPool::Lease::operator=(Lease&& other) noexcept -> Lease& {
+        if (this != &other) {
+            if (mPool != nullptr) {
+                mPool->release(mThread);
+            }
+
+            mPool = std::exchange(other.mPool, nullptr);
+            mThread = std::exchange(other.mThread, nullptr);
+        }
+
+        return *this;
+    }
+
+    bool WordConnectionPool::Lease::isValid() const {
+        return mPool != nullptr;
+    }
+
+    WordConnectionPool::WordConnectionPool(const QString& databaseName, const QString& connectionPrefix, qint32 maxConnections)
+        : mDatabaseName(databaseName)
+        , mConnectionPrefix(connectionPrefix)
+        , mMaxConnections(maxConnections)
+        , mConnectionCounter(0) {
+    }
+
+    WordConnectionPool::~WordConnectionPool() {
+        closeAll();
+    }
+
+    void WordConnectionPool::setStatements(const QStringList& statements) {
+        QMutexLocker locker(&mMutex);
+        mStatements = statements;
+    }
+
+    auto WordConnectionPool::size() const -> qint32 {
+        QMutexLocker locker(&mMutex);
+        return static_cast<qint32>(mConnections.size());
+    }
+
+    auto WordConnectionPool::acquire() -> Lease {
+        QThread* currentThread = QThread::currentThread();
+
+        QMutexLocker locker(&mMutex);
+
+        if (mMaxConnections <= 0) {
+            qWarning() << TAG << "Reader connections are disabled" << Qt::endl;
+            return {};
+        }
+
+        if (auto it = mConnections.find(currentThread); it != mConnections.end()) {
+            ++it->second->leaseCount;
+            return Lease(this, currentThread);
+        }
+
+        /*
+         * Connections are pinned to their threads, a slot frees up only when one of them finishes.
+         */
+        QDeadlineTimer deadline(ACQUIRE_TIMEOUT_MS);
+
+        while (static_cast<qint32>(mConnections.size()) >= mMaxConnections) {
+            if (!mConnectionClosed.wait(&mMutex, deadline)) {
+                qWarning() << TAG << "No free reader connection after " << ACQUIRE_TIMEOUT_MS << " ms, pool size is " << mMaxConnections << Qt::endl;
+                return {};
+            }
+        }
+
+        Connection& connection = *mConnections.emplace(currentThread, std::make_unique<Connection>(
+            Connection { QString{}, QSqlDatabase{}, {}, QMetaObject::Connection{}, 1 })).first->second;
+
+        locker.unlock();
+
+        if (!openConnection(connection)) {
+            locker.relock();
+            mConnections.erase(currentThread);
+            mConnectionClosed.wakeOne();
+            return {};
+        }
+
+        /*
+         * Emitted from the finishing thread itself, so the connection is closed where it was opened.
+         */
+        connection.threadFinished = QObject::connect(currentThread, &QThread::finished, [this, currentThread]() {
+            closeThreadConnection(currentThread);
+        });
+
+        return Lease(this, currentThread);
+    }
+
+    void WordConnectionPool::release(QThread* thread) {
+        QMutexLocker locker(&mMutex);
+
+        if (auto it = mConnections.find(thread); it != mConnections.end() && it->second->leaseCount > 0) {
+            --it->second->leaseCount;
+        }
+    }
+
+    auto WordConnectionPool::leasedConnection() -> Connection* {
+        QMutexLocker locker(&mMutex);
+
+        const auto it = mConnections.find(QThread::currentThread());
+
+        return it != mConnections.end() && it->second->leaseCount > 0 ? it->second.get() : nullptr;
+    }
+
+    auto WordConnectionPool::statement(qsizetype index) -> QSqlQuery* {
+        Connection* connection = leasedConnection();
+
+        if (connection == nullptr || index < 0 || index >= connection->statements.size()) {
+            return nullptr;
+        }
+
+        QSqlQuery& query = connection->statements[index];
+
+        if (query.lastQuery().isEmpty()) {
+            QString sql;
+            {
+                QMutexLocker locker(&mMutex);
+                sql = mStatements.value(index);
+            }
+
+            if (!query.prepare(sql)) {
+                qWarning() << TAG << "Prepare reader statement error: " << query.lastError() << Qt::endl;
+            }
+        }
+
+        return &query;
+    }
+
+    auto WordConnectionPool::database() -> QSqlDatabase {
+        Connection* connection = leasedConnection();
+
+        return connection != nullptr ? connection->database : QSqlDatabase{};
+    }
+
+    bool WordConnectionPool::openConnection(Connection& connection) {
+        qsizetype statementCount = 0;
+        {
+            QMutexLocker locker(&mMutex);
+
+            connection.name = QString("%1_reader_%2").arg(mConnectionPrefix).arg(++mConnectionCounter);
+            statementCount = mStatements.size();
+        }
+
+        connection.database = QSqlDatabase::addDatabase("QSQLITE", connection.name);
+        connection.database.setDatabaseName(mDatabaseName);
+        connection.database.setConnectOptions(READER_OPTIONS);
+
+        if (!connection.database.open()) {
+            qWarning() << TAG << "Can't open reader connection: " << connection.database.lastError() << Qt::endl;
+
+            connection.database = QSqlDatabase{};
+            QSqlDatabase::removeDatabase(connection.name);
+            return false;
+        }
+
+        connection.statements.reserve(statementCount);
+
+        for (qsizetype i = 0; i < statementCount; ++i) {
+            connection.statements.push_back(QSqlQuery(connection.database));
+        }
+
+        qInfo() << TAG << "Reader connection " << connection.name << " opened!" << Qt::endl;
+
+        return true;
+    }
+
+    void WordConnectionPool::closeThreadConnection(QThread* thread) {
+        std::unique_ptr<Connection> connection;
+        {
+            QMutexLocker locker(&mMutex);
+
+            auto it = mConnections.find(thread);
+
+            if (it == mConnections.end()) {
+                return;
+            }
+
+            connection = std::move(it->second);
+            mConnections.erase(it);
+        }
+
+        QObject::disconnect(connection->threadFinished);
+        closeConnection(*connection);
+
+        QMutexLocker locker(&mMutex);
+        mConnectionClosed.wakeOne();
+    }
+
+    void WordConnectionPool::closeAll() {
+        std::unordered_map<QThread*, std::unique_ptr<Connection>> connections;
+        {
+            QMutexLocker locker(&mMutex);
+            connections.swap(mConnections);
+        }
+
+        QThread* currentThread = QThread::currentThread();
+
+        for (auto& [thread, connection] : connections) {
+            QObject::disconnect(connection->threadFinished);
+
+            if (thread == currentThread) {
+                closeConnection(*connection);
+                continue;
+            }
+
+            /*
+             * Closing it here would use the connection off its thread, leaking it is the lesser evil.
+             */
+            qWarning() << TAG << "Reader connection " << connection->name << " is left open, its thread still runs" << Qt::endl;
+            static_cast<void>(connection.release());
+        }
+    }
+
+    void WordConnectionPool::closeConnection(Connection& connection) {
+        for (QSqlQuery& query : connection.statements) {
+            query.finish();
+        }
+        connection.statements.clear();
+
+        connection.database.close();
+        connection.database = QSqlDatabase{};
+        QSqlDatabase::removeDatabase(connection.name);
+
+        qInfo() << TAG << "Reader connection " << connection.name << " closed!" << Qt::endl;
+    }
+}
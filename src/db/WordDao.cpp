@@ -23,30 +23,157 @@
  */
 
 #include "db/WordDao.hpp"
+#include "db/WordTextCodec.hpp"
+#include "db/SqliteHandle.hpp"
+#include "util/WordNormalizer.hpp"
+
+#include <QBuffer>
+
+#include <algorithm>
 
 namespace {
     constexpr const char* const TAG = "[WordDao] ";
     constexpr const char* const DB_CONNECTION = "grunwald_connection";
     constexpr const char* const DB_FILE = "grunwald.sqlite";
     constexpr const char* const DATETIME_FORMAT = "dd.MM.yyyy HH:mm:ss";
+    constexpr const char* const NO_CONNECTION_ERROR = "Database connection is not available for the current thread";
+
+    constexpr qint32 SCHEMA_VERSION = 6;
+
+    /*
+     * Rows sampled per index by ANALYZE, keeps it fast on large databases.
+     */
+    constexpr qint32 ANALYSIS_LIMIT = 400;
+
+    /*
+     * Value of PRAGMA auto_vacuum for the incremental mode.
+     */
+    constexpr qint64 INCREMENTAL_VACUUM = 2;
+
+    /*
+     * Columns of a word row in select order. A column index is its position
+     * in this list, so rows are mapped without looking column names up.
+     */
+    enum class WordColumn : std::size_t {
+        Id,
+        Name,
+        Transcription,
+        Translation,
+        Association,
+        Etymology,
+        Description,
+        Type,
+        Date,
+        ImageId,
+        ImageUrl,
+        ImageWidth,
+        ImageHeight,
+        ImageData,
+
+        Count
+    };
+
+    struct WordColumnDefinition final {
+        WordColumn column;
+        const char* expression;
+    };
+
+    constexpr std::array<WordColumnDefinition, static_cast<std::size_t>(WordColumn::Count)> WORD_COLUMNS = {{
+        { WordColumn::Id,            "word.id AS word_id" },
+        { WordColumn::Name,          "word.name AS name" },
+        { WordColumn::Transcription, "word.transcription AS transcription" },
+        { WordColumn::Translation,   "word.translation AS translation" },
+        { WordColumn::Association,   "word.association AS association" },
+        { WordColumn::Etymology,     "word.etymology AS etymology" },
+        { WordColumn::Description,   "word.description AS description" },
+        { WordColumn::Type,          "word.type AS type" },
+        { WordColumn::Date,          "word.date AS date" },
+        { WordColumn::ImageId,       "word_image.id AS image_id" },
+        { WordColumn::ImageUrl,      "word_image.url AS image_url" },
+        { WordColumn::ImageWidth,    "word_image.width AS image_width" },
+        { WordColumn::ImageHeight,   "word_image.height AS image_height" },
+        { WordColumn::ImageData,     "word_image.data AS image_data" },
+    }};
+
+    constexpr bool isColumnOrderValid() {
+        for (std::size_t i = 0; i < WORD_COLUMNS.size(); ++i) {
+            if (static_cast<std::size_t>(WORD_COLUMNS[i].column) != i) {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    static_assert(isColumnOrderValid(), "WORD_COLUMNS must follow WordColumn order");
+
+    constexpr auto columnIndex(WordColumn column) -> int {
+        return static_cast<int>(column);
+    }
+
+    /*
+     * Select list from the first column up to lastColumn inclusive.
+     */
+    auto prepareSelectColumns(WordColumn lastColumn) -> QString {
+        QStringList expressions;
+
+        for (const WordColumnDefinition& definition : WORD_COLUMNS) {
+            expressions.push_back(QLatin1StringView(definition.expression));
+
+            if (definition.column == lastColumn) {
+                break;
+            }
+        }
+
+        return "SELECT " + expressions.join(", ");
+    }
+
+    /*
+     * Turns user input into a safe FTS5 expression: every term is quoted
+     * and matched as prefix, so operators and quotes can't break the query.
+     */
+    auto prepareFullTextQuery(const QString& text) -> QString {
+        QStringList terms;
+
+        for (const QString& term : text.split(QRegularExpression("\\s+"), Qt::SkipEmptyParts)) {
+            QString escapedTerm = term;
+            escapedTerm.replace('"', "\"\"");
+
+            terms.push_back('"' + escapedTerm + "\"*");
+        }
+
+        return terms.join(' ');
+    }
 }
 
 namespace grunwald {
 
-    WordDao::WordDao()
-        : mDatabase(openDatabase())
+    WordDao::WordDao(JournalMode journalMode, TextEncoding textEncoding)
+        : WordDao(DB_FILE, journalMode, textEncoding) {}
+
+    WordDao::WordDao(const QString& databaseName, JournalMode journalMode, TextEncoding textEncoding)
+        : mJournalMode(journalMode)
+        , mTextEncoding(textEncoding)
+        , mTextFunctions(false)
+        , mOwnerThread(QThread::currentThread())
+        , mDatabase(openDatabase(databaseName))
         , mSqlQuery(QSqlQuery(mDatabase))
-        , mSqlRecord(mSqlQuery.record()) {
+        , mConnectionPool(databaseName, DB_CONNECTION, journalMode == JournalMode::Wal ? READER_CONNECTIONS : 0) {
         createTables();
     }
 
     WordDao::~WordDao() {
+        mConnectionPool.closeAll();
         closeDatabase();
     }
 
-    auto WordDao::openDatabase() -> QSqlDatabase {
+    auto WordDao::openDatabase(const QString& databaseName) -> QSqlDatabase {
         auto database = QSqlDatabase::addDatabase("QSQLITE", DB_CONNECTION);
-        database.setDatabaseName(DB_FILE);
+        database.setDatabaseName(databaseName);
+
+        if (mJournalMode == JournalMode::ReadOnly) {
+            database.setConnectOptions("QSQLITE_OPEN_READONLY");
+        }
 
         if (!database.open()) {
             qWarning() << TAG << "Can't open database: " << database.lastError() << Qt::endl;
@@ -58,23 +185,62 @@ namespace grunwald {
     }
 
     void WordDao::closeDatabase() {
+        for (QSqlQuery& query : mStatements) {
+            query.finish();
+            query = QSqlQuery{};
+        }
+        mSqlQuery = QSqlQuery{};
+
         mDatabase.close();
+        mDatabase = QSqlDatabase{};
         QSqlDatabase::removeDatabase(DB_CONNECTION);
 
         qInfo() << TAG << "Database closed!" << Qt::endl;
     }
 
     void WordDao::createTables() {
-        if (!mSqlQuery.exec("PRAGMA locking_mode = EXCLUSIVE")) {
+        if (mJournalMode == JournalMode::ReadOnly) {
+            if (const qint32 version = schemaVersion(); version != SCHEMA_VERSION) {
+                qWarning() << TAG << "Database schema version " << version << " is opened read-only without migration" << Qt::endl;
+            }
+
+            prepareStatements();
+            return;
+        }
+
+        enableIncrementalVacuum();
+
+        if (mJournalMode == JournalMode::Wal) {
+            if (!mSqlQuery.exec("PRAGMA journal_mode = WAL") || !mSqlQuery.exec("PRAGMA synchronous = NORMAL")) {
+                qWarning() << TAG << "Database could not set WAL journal mode!" << mSqlQuery.lastError() << Qt::endl;
+            }
+        } else if (!mSqlQuery.exec("PRAGMA locking_mode = EXCLUSIVE")) {
             qWarning() << TAG << "Database could not set locking mode!" << mSqlQuery.lastError() << Qt::endl;
         }
 
+        mTextFunctions = WordTextCodec::registerFunctions(mDatabase);
+
+        /*
+         * Triggers calling word_text() would fail every write, they are replaced before migrations update rows.
+         */
+        if (!mTextFunctions) {
+            qWarning() << TAG << "Function `word_text` is not available, HTML fields are stored as plain text" << Qt::endl;
+
+            mTextEncoding = TextEncoding::Plain;
+
+            if (fullTextTriggerSql().contains("word_text(")) {
+                dropFullTextTriggers();
+            }
+        }
+
         if (!mSqlQuery.exec(R"xxx(CREATE TABLE IF NOT EXISTS word_image (
                                     id INTEGER PRIMARY KEY AUTOINCREMENT,
                                     url TEXT,
                                     width INT NOT NULL,
                                     height INT NOT NULL,
-                                    data BLOB);
+                                    data BLOB,
+                                    hash BLOB,
+                                    ref_count INT NOT NULL DEFAULT (0));
                             )xxx")) {
             qWarning() << TAG << "Table `word_image` was not created!" << mSqlQuery.lastError() << Qt::endl;
         } else {
@@ -87,6 +253,7 @@ namespace grunwald {
                                     id INTEGER PRIMARY KEY AUTOINCREMENT,
                                     id_image INT NOT NULL,
                                     name TEXT NOT NULL,
+                                    name_key TEXT NOT NULL DEFAULT (''),
                                     transcription TEXT NOT NULL,
                                     translation TEXT NOT NULL,
                                     association TEXT NOT NULL,
@@ -102,22 +269,608 @@ namespace grunwald {
         }
 
         mSqlQuery.executedQuery();
+
+        createMissTable();
+        migrateTables();
+
+        if (!mSqlQuery.exec("CREATE INDEX IF NOT EXISTS word_name_index ON word (name, id)")) {
+            qWarning() << TAG << "Index `word_name_index` was not created!" << mSqlQuery.lastError() << Qt::endl;
+        }
+
+        /*
+         * Folded keys only find words, different headwords may share one key.
+         */
+        if (!mSqlQuery.exec("CREATE INDEX IF NOT EXISTS word_name_key_index ON word (name_key)")) {
+            qWarning() << TAG << "Index `word_name_key_index` was not created!" << mSqlQuery.lastError() << Qt::endl;
+        }
+
+        /*
+         * Fails while headwords saved twice by older versions are kept, words are then updated by name without it.
+         */
+        if (!mSqlQuery.exec("CREATE UNIQUE INDEX IF NOT EXISTS word_name_unique_index ON word (name)")) {
+            qWarning() << TAG << "Index `word_name_unique_index` was not created!" << mSqlQuery.lastError() << Qt::endl;
+        }
+
+        if (!mSqlQuery.exec("CREATE UNIQUE INDEX IF NOT EXISTS word_image_hash_index ON word_image (hash)")) {
+            qWarning() << TAG << "Index `word_image_hash_index` was not created!" << mSqlQuery.lastError() << Qt::endl;
+        }
+
+        /*
+         * Images are shared by content hash, every word holds one reference
+         * and an image is deleted together with its last reference.
+         */
+        const QStringList imageTriggers = {
+            R"xxx(CREATE TRIGGER IF NOT EXISTS word_image_ref_insert AFTER INSERT ON word BEGIN
+                      UPDATE word_image SET ref_count = ref_count + 1 WHERE id = new.id_image;
+                  END;)xxx",
+            R"xxx(CREATE TRIGGER IF NOT EXISTS word_image_ref_update
+                  AFTER UPDATE OF id_image ON word WHEN old.id_image <> new.id_image BEGIN
+                      UPDATE word_image SET ref_count = ref_count + 1 WHERE id = new.id_image;
+                      UPDATE word_image SET ref_count = ref_count - 1 WHERE id = old.id_image;
+                      DELETE FROM word_image WHERE id = old.id_image AND ref_count <= 0;
+                  END;)xxx",
+            R"xxx(CREATE TRIGGER IF NOT EXISTS word_image_ref_delete AFTER DELETE ON word BEGIN
+                      UPDATE word_image SET ref_count = ref_count - 1 WHERE id = old.id_image;
+                      DELETE FROM word_image WHERE id = old.id_image AND ref_count <= 0;
+                  END;)xxx"
+        };
+
+        for (const QString& trigger : imageTriggers) {
+            if (!mSqlQuery.exec(trigger)) {
+                qWarning() << TAG << "Trigger for `word_image` was not created!" << mSqlQuery.lastError() << Qt::endl;
+            }
+        }
+
+        createFullTextIndex();
+        prepareStatements();
+    }
+
+    void WordDao::enableIncrementalVacuum() {
+        /*
+         * A new database takes the mode with its first table. An existing one would need
+         * a full VACUUM to switch, which blocks startup, so it stays without auto vacuum.
+         */
+        if (pragmaValue("page_count") > 0) {
+            if (pragmaValue("auto_vacuum") != INCREMENTAL_VACUUM) {
+                qInfo() << TAG << "Database was created without incremental auto vacuum" << Qt::endl;
+            }
+
+            return;
+        }
+
+        if (!mSqlQuery.exec("PRAGMA auto_vacuum = INCREMENTAL")) {
+            qWarning() << TAG << "Database could not set incremental auto vacuum!" << mSqlQuery.lastError() << Qt::endl;
+        }
+    }
+
+    auto WordDao::pragmaValue(const QString& pragma) -> qint64 {
+        qint64 value = -1;
+
+        if (mSqlQuery.exec("PRAGMA " + pragma) && mSqlQuery.first()) {
+            value = mSqlQuery.value(0).toLongLong();
+        } else {
+            qWarning() << TAG << "Database could not read pragma " << pragma << mSqlQuery.lastError() << Qt::endl;
+        }
+
+        mSqlQuery.finish();
+
+        return value;
+    }
+
+    auto WordDao::schemaVersion() -> qint32 {
+        if (!mSqlQuery.exec("PRAGMA user_version") || !mSqlQuery.first()) {
+            qWarning() << TAG << "Database could not read schema version!" << mSqlQuery.lastError() << Qt::endl;
+            return SCHEMA_VERSION;
+        }
+
+        return mSqlQuery.value(0).toInt();
+    }
+
+    void WordDao::migrateTables() {
+        const qint32 version = schemaVersion();
+
+        if (version >= SCHEMA_VERSION) {
+            return;
+        }
+
+        qInfo() << TAG << "Migrate database schema from version " << version << " to " << SCHEMA_VERSION << Qt::endl;
+
+        if (!mDatabase.transaction()) {
+            qWarning() << TAG << "Migration transaction was not started!" << mDatabase.lastError() << Qt::endl;
+            return;
+        }
+
+        /*
+         * The key index is not unique since schema 5, it is created again after the migration.
+         */
+        bool success = mSqlQuery.exec("DROP INDEX IF EXISTS word_name_key_index");
+
+        if (success && version < 1) {
+            success = migrateNameKey();
+        }
+
+        if (success && version < 2) {
+            success = migrateImageHash();
+        }
+
+        if (success && version < 3) {
+            success = migrateFullTextTriggers();
+        }
+
+        /*
+         * Keys are folded the German way since schema 4, existing keys are computed again.
+         */
+        if (success && version >= 1 && version < 4) {
+            success = migrateNameKey();
+        }
+
+        if (success && version < 6) {
+            success = migrateMisses();
+        }
+
+        if (success && mSqlQuery.exec(QString("PRAGMA user_version = %1").arg(SCHEMA_VERSION)) && mDatabase.commit()) {
+            qInfo() << TAG << "Database schema was migrated!" << Qt::endl;
+        } else {
+            qWarning() << TAG << "Database schema was not migrated!" << mSqlQuery.lastError() << Qt::endl;
+            mDatabase.rollback();
+        }
+    }
+
+    bool WordDao::createMissTable() {
+        /*
+         * Misses are remembered per exact headword, the remote dictionary tells "Masse" and "Maße" apart.
+         */
+        if (!mSqlQuery.exec(R"xxx(CREATE TABLE IF NOT EXISTS word_miss (
+                                    name TEXT PRIMARY KEY,
+                                    reason INT NOT NULL,
+                                    expires_at INT NOT NULL) WITHOUT ROWID;
+                            )xxx")) {
+            qWarning() << TAG << "Table `word_miss` was not created!" << mSqlQuery.lastError() << Qt::endl;
+            return false;
+        }
+
+        if (!mSqlQuery.exec("CREATE INDEX IF NOT EXISTS word_miss_expires_index ON word_miss (expires_at)")) {
+            qWarning() << TAG << "Index `word_miss_expires_index` was not created!" << mSqlQuery.lastError() << Qt::endl;
+            return false;
+        }
+
+        return true;
+    }
+
+    bool WordDao::migrateMisses() {
+        /*
+         * Misses were keyed by folded name before schema 6. They only save
+         * network requests, so the table is created again instead of converted.
+         */
+        if (!mSqlQuery.exec("DROP TABLE IF EXISTS word_miss")) {
+            qWarning() << TAG << "Table `word_miss` was not dropped!" << mSqlQuery.lastError() << Qt::endl;
+            return false;
+        }
+
+        return createMissTable();
+    }
+
+    bool WordDao::migrateNameKey() {
+        bool columnExists = false;
+
+        if (mSqlQuery.exec("SELECT COUNT(*) FROM pragma_table_info('word') WHERE name='name_key'") && mSqlQuery.first()) {
+            columnExists = mSqlQuery.value(0).toInt() != 0;
+        }
+
+        if (!columnExists && !mSqlQuery.exec("ALTER TABLE word ADD COLUMN name_key TEXT NOT NULL DEFAULT ('')")) {
+            qWarning() << TAG << "Column `name_key` was not added!" << mSqlQuery.lastError() << Qt::endl;
+            return false;
+        }
+
+        QVector<QPair<qint64, QString>> keys;
+
+        if (!mSqlQuery.exec("SELECT id, name FROM word")) {
+            qWarning() << TAG << "Column `name_key` was not filled!" << mSqlQuery.lastError() << Qt::endl;
+            return false;
+        }
+
+        while (mSqlQuery.next()) {
+            keys.push_back({ mSqlQuery.value(0).toLongLong(), WordNormalizer::toKey(mSqlQuery.value(1).toString()) });
+        }
+
+        QSqlQuery updateQuery(mDatabase);
+        updateQuery.prepare("UPDATE word SET name_key=? WHERE id=?");
+
+        for (const auto& [id, key] : keys) {
+            updateQuery.addBindValue(key);
+            updateQuery.addBindValue(id);
+
+            if (!updateQuery.exec()) {
+                qWarning() << TAG << "Column `name_key` was not filled!" << updateQuery.lastError() << Qt::endl;
+                return false;
+            }
+        }
+
+        /*
+         * Words sharing a key are all kept, a migration never removes saved words.
+         */
+        if (!mSqlQuery.exec(R"xxx(SELECT name_key, GROUP_CONCAT(name, ', ') FROM word
+                                  GROUP BY name_key HAVING COUNT(*) > 1)xxx")) {
+            qWarning() << TAG << "Key collisions were not checked!" << mSqlQuery.lastError() << Qt::endl;
+            return true;
+        }
+
+        while (mSqlQuery.next()) {
+            qInfo() << TAG << "Words " << mSqlQuery.value(1).toString()
+                    << " share the key " << mSqlQuery.value(0).toString() << ", all of them are kept" << Qt::endl;
+        }
+
+        mSqlQuery.finish();
+
+        return true;
+    }
+
+    bool WordDao::migrateImageHash() {
+        bool columnExists = false;
+
+        if (mSqlQuery.exec("SELECT COUNT(*) FROM pragma_table_info('word_image') WHERE name='hash'") && mSqlQuery.first()) {
+            columnExists = mSqlQuery.value(0).toInt() != 0;
+        }
+
+        if (!columnExists && (!mSqlQuery.exec("ALTER TABLE word_image ADD COLUMN hash BLOB") ||
+                              !mSqlQuery.exec("ALTER TABLE word_image ADD COLUMN ref_count INT NOT NULL DEFAULT (0)"))) {
+            qWarning() << TAG << "Columns `hash` and `ref_count` were not added!" << mSqlQuery.lastError() << Qt::endl;
+            return false;
+        }
+
+        /*
+         * Schema 1 deleted the old image on every relink, which would break shared images.
+         */
+        if (!mSqlQuery.exec("DROP TRIGGER IF EXISTS word_image_release")) {
+            qWarning() << TAG << "Trigger `word_image_release` was not dropped!" << mSqlQuery.lastError() << Qt::endl;
+            return false;
+        }
+
+        QSqlQuery selectQuery(mDatabase);
+        selectQuery.setForwardOnly(true);
+
+        QSqlQuery updateQuery(mDatabase);
+        updateQuery.prepare("UPDATE word_image SET hash=? WHERE id=?");
+
+        if (!selectQuery.exec("SELECT id, data FROM word_image WHERE data IS NOT NULL AND length(data) > 0")) {
+            qWarning() << TAG << "Column `hash` was not filled!" << selectQuery.lastError() << Qt::endl;
+            return false;
+        }
+
+        while (selectQuery.next()) {
+            updateQuery.addBindValue(QCryptographicHash::hash(selectQuery.value(1).toByteArray(), QCryptographicHash::Sha256));
+            updateQuery.addBindValue(selectQuery.value(0));
+
+            if (!updateQuery.exec()) {
+                qWarning() << TAG << "Column `hash` was not filled!" << updateQuery.lastError() << Qt::endl;
+                return false;
+            }
+        }
+
+        /*
+         * Relink words to the oldest copy of identical bytes, then drop copies and orphans.
+         */
+        if (!mSqlQuery.exec(R"xxx(UPDATE word SET id_image = (
+                                      SELECT MIN(duplicate.id) FROM word_image AS duplicate
+                                      JOIN word_image AS original ON original.hash = duplicate.hash
+                                      WHERE original.id = word.id_image)
+                                  WHERE id_image IN (SELECT id FROM word_image WHERE hash IS NOT NULL);
+                            )xxx") ||
+            !mSqlQuery.exec("DELETE FROM word_image WHERE id NOT IN (SELECT id_image FROM word)") ||
+            !mSqlQuery.exec("UPDATE word_image SET ref_count = (SELECT COUNT(*) FROM word WHERE word.id_image = word_image.id)")) {
+            qWarning() << TAG << "Duplicated images were not removed!" << mSqlQuery.lastError() << Qt::endl;
+            return false;
+        }
+
+        return true;
+    }
+
+    bool WordDao::migrateFullTextTriggers() {
+        /*
+         * Schema 2 triggers indexed raw column values, they are recreated to index decoded text.
+         */
+        for (const char* trigger : { "word_fts_insert", "word_fts_delete", "word_fts_update" }) {
+            if (!mSqlQuery.exec(QString("DROP TRIGGER IF EXISTS %1").arg(trigger))) {
+                qWarning() << TAG << "Trigger " << trigger << " was not dropped!" << mSqlQuery.lastError() << Qt::endl;
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    void WordDao::createFullTextIndex() {
+        bool indexExists = false;
+
+        if (mSqlQuery.exec("SELECT COUNT(*) FROM sqlite_master WHERE type='table' AND name='word_fts'") && mSqlQuery.first()) {
+            indexExists = mSqlQuery.value(0).toInt() != 0;
+        }
+
+        if (!mSqlQuery.exec(R"xxx(CREATE VIRTUAL TABLE IF NOT EXISTS word_fts USING fts5(
+                                    name,
+                                    translation,
+                                    description,
+                                    etymology,
+                                    content='word',
+                                    content_rowid='id',
+                                    tokenize='unicode61 remove_diacritics 2');
+                            )xxx")) {
+            qWarning() << TAG << "Table `word_fts` was not created!" << mSqlQuery.lastError() << Qt::endl;
+            return;
+        }
+
+        /*
+         * Without word_text() stored values are indexed as they are, so compressed ones are decoded first.
+         */
+        const auto text = [this](const QString& column) {
+            return mTextFunctions ? QString("word_text(%1)").arg(column) : column;
+        };
+
+        const QString triggerSql = fullTextTriggerSql();
+        const bool triggersMatch = !triggerSql.isEmpty() && triggerSql.contains("word_text(") == mTextFunctions;
+
+        bool rebuildIndex = !indexExists;
+
+        if (!triggersMatch) {
+            dropFullTextTriggers();
+
+            if (!mTextFunctions) {
+                decodeStoredText();
+            }
+
+            rebuildIndex = true;
+        }
+
+        const QStringList triggers = {
+            QString(R"xxx(CREATE TRIGGER IF NOT EXISTS word_fts_insert AFTER INSERT ON word BEGIN
+                              INSERT INTO word_fts (rowid, name, translation, description, etymology)
+                              VALUES (new.id, new.name, %1, %2, %3);
+                          END;)xxx").arg(text("new.translation"), text("new.description"), text("new.etymology")),
+            QString(R"xxx(CREATE TRIGGER IF NOT EXISTS word_fts_delete AFTER DELETE ON word BEGIN
+                              INSERT INTO word_fts (word_fts, rowid, name, translation, description, etymology)
+                              VALUES ('delete', old.id, old.name, %1, %2, %3);
+                          END;)xxx").arg(text("old.translation"), text("old.description"), text("old.etymology")),
+            QString(R"xxx(CREATE TRIGGER IF NOT EXISTS word_fts_update AFTER UPDATE ON word BEGIN
+                              INSERT INTO word_fts (word_fts, rowid, name, translation, description, etymology)
+                              VALUES ('delete', old.id, old.name, %1, %2, %3);
+                              INSERT INTO word_fts (rowid, name, translation, description, etymology)
+                              VALUES (new.id, new.name, %4, %5, %6);
+                          END;)xxx").arg(text("old.translation"), text("old.description"), text("old.etymology"),
+                                         text("new.translation"), text("new.description"), text("new.etymology"))
+        };
+
+        for (const QString& trigger : triggers) {
+            if (!mSqlQuery.exec(trigger)) {
+                qWarning() << TAG << "Trigger for `word_fts` was not created!" << mSqlQuery.lastError() << Qt::endl;
+            }
+        }
+
+        /*
+         * 'rebuild' would read compressed values straight from `word`, so the index is filled with decoded text.
+         */
+        if (rebuildIndex) {
+            if (!mSqlQuery.exec("INSERT INTO word_fts (word_fts) VALUES ('delete-all')") ||
+                !mSqlQuery.exec(QString(R"xxx(INSERT INTO word_fts (rowid, name, translation, description, etymology)
+                                              SELECT id, name, %1, %2, %3 FROM word;
+                                        )xxx").arg(text("translation"), text("description"), text("etymology")))) {
+                qWarning() << TAG << "Table `word_fts` was not rebuilt!" << mSqlQuery.lastError() << Qt::endl;
+            } else {
+                qInfo() << TAG << "Table `word_fts` was rebuilt!" << Qt::endl;
+            }
+        }
+    }
+
+    auto WordDao::fullTextTriggerSql() -> QString {
+        QString triggerSql;
+
+        if (mSqlQuery.exec("SELECT sql FROM sqlite_master WHERE type='trigger' AND name='word_fts_insert'") && mSqlQuery.first()) {
+            triggerSql = mSqlQuery.value(0).toString();
+        }
+
+        mSqlQuery.finish();
+
+        return triggerSql;
+    }
+
+    void WordDao::dropFullTextTriggers() {
+        for (const char* trigger : { "word_fts_insert", "word_fts_delete", "word_fts_update" }) {
+            if (!mSqlQuery.exec(QString("DROP TRIGGER IF EXISTS %1").arg(trigger))) {
+                qWarning() << TAG << "Trigger " << trigger << " was not dropped!" << mSqlQuery.lastError() << Qt::endl;
+            }
+        }
+    }
+
+    void WordDao::decodeStoredText() {
+        QSqlQuery selectQuery(mDatabase);
+        selectQuery.setForwardOnly(true);
+
+        if (!selectQuery.exec(R"xxx(SELECT id, transcription, translation, association, etymology, description FROM word
+                                    WHERE typeof(transcription)='blob' OR typeof(translation)='blob' OR typeof(association)='blob'
+                                       OR typeof(etymology)='blob' OR typeof(description)='blob';
+                              )xxx")) {
+            qWarning() << TAG << "Compressed words were not selected!" << selectQuery.lastError() << Qt::endl;
+            return;
+        }
+
+        QVector<QVariantList> rows;
+
+        while (selectQuery.next()) {
+            QVariantList row;
+
+            for (int column = 1; column <= 5; ++column) {
+                row.push_back(WordTextCodec::decode(selectQuery.value(column)));
+            }
+
+            row.push_back(selectQuery.value(0));
+            rows.push_back(std::move(row));
+        }
+
+        selectQuery.finish();
+
+        if (rows.isEmpty()) {
+            return;
+        }
+
+        QSqlQuery updateQuery(mDatabase);
+        updateQuery.prepare(R"xxx(UPDATE word SET
+                                      transcription=?, translation=?, association=?, etymology=?, description=?
+                                  WHERE id=?;
+                            )xxx");
+
+        mDatabase.transaction();
+
+        for (const QVariantList& row : rows) {
+            for (const QVariant& value : row) {
+                updateQuery.addBindValue(value);
+            }
+
+            if (!updateQuery.exec()) {
+                qWarning() << TAG << "Compressed word was not decoded!" << updateQuery.lastError() << Qt::endl;
+                mDatabase.rollback();
+                return;
+            }
+        }
+
+        if (mDatabase.commit()) {
+            qInfo() << TAG << "Decoded " << rows.size() << " compressed words to plain text" << Qt::endl;
+        } else {
+            qWarning() << TAG << "Compressed words were not decoded!" << mDatabase.lastError() << Qt::endl;
+            mDatabase.rollback();
+        }
+    }
+
+    void WordDao::prepareStatements() {
+        QStringList statementsSql(static_cast<qsizetype>(Statement::Count));
+
+        const auto prepare = [this, &statementsSql](Statement type, const QString& sql) {
+            QSqlQuery query(mDatabase);
+
+            if (!query.prepare(sql)) {
+                qWarning() << TAG << "Prepare statement error: " << query.lastError() << Qt::endl;
+            }
+
+            statementsSql[static_cast<qsizetype>(type)] = sql;
+            mStatements[static_cast<std::size_t>(type)] = std::move(query);
+        };
+
+        const QString selectColumns = prepareSelectColumns(WordColumn::ImageHeight);
+        const QString selectWord = selectColumns + R"xxx(
+                                FROM word
+                                LEFT JOIN word_image ON word.id_image = word_image.id)xxx";
+
+        prepare(Statement::CheckIfExists, "SELECT COUNT(*) FROM word WHERE name=?");
+
+        prepare(Statement::FindImage, "SELECT id FROM word_image WHERE hash=?");
+        prepare(Statement::AddImage, R"xxx(INSERT INTO word_image (url, width, height, data, hash)
+                                           VALUES (?, ?, ?, ?, ?);
+                                     )xxx");
+        /*
+         * Not an upsert on the unique name index: the index is missing while
+         * headwords saved twice by older versions are kept.
+         */
+        prepare(Statement::AddWord, R"xxx(INSERT INTO word (
+                                              id_image, name, name_key, transcription, translation,
+                                              association, etymology, description,
+                                              type, date)
+                                          VALUES (?, ?, ?, ?, ?, ?, ?, ?, ?, ?);
+                                    )xxx");
+        prepare(Statement::UpdateWordByName, R"xxx(UPDATE word SET
+                                                       id_image=?, transcription=?, translation=?,
+                                                       association=?, etymology=?, description=?,
+                                                       type=?, date=?
+                                                   WHERE name=?;
+                                             )xxx");
+
+        prepare(Statement::UpdateWord, R"xxx(UPDATE word SET
+                                                 id_image=?, name=?, name_key=?, transcription=?, translation=?,
+                                                 association=?, etymology=?, description=?,
+                                                 type=?, date=?
+                                             WHERE id=?;
+                                       )xxx");
+
+        prepare(Statement::RemoveWord, "DELETE FROM word WHERE name=?;");
+
+        prepare(Statement::Get, prepareSelectColumns(WordColumn::ImageData) + R"xxx(
+                                FROM word
+                                LEFT JOIN word_image ON word.id_image = word_image.id
+                                WHERE word.id=?)xxx");
+        prepare(Statement::GetAll, selectWord);
+        prepare(Statement::GetNames, "SELECT name FROM word");
+        prepare(Statement::Search, selectWord + " WHERE word.name_key = :name_key");
+        prepare(Statement::FullTextSearch, selectColumns + R"xxx(
+                                FROM word_fts
+                                JOIN word ON word.id = word_fts.rowid
+                                LEFT JOIN word_image ON word.id_image = word_image.id
+                                WHERE word_fts MATCH :query
+                                ORDER BY bm25(word_fts, 10.0, 5.0, 2.0, 1.0)
+                                LIMIT :limit)xxx");
+        prepare(Statement::Page, selectWord + R"xxx(
+                                WHERE (word.name, word.id) > (:after_name, :after_id)
+                                ORDER BY word.name, word.id
+                                LIMIT :limit)xxx");
+        prepare(Statement::LoadImageData, "SELECT data FROM word_image WHERE id=?");
+        prepare(Statement::FindMiss, "SELECT reason, expires_at FROM word_miss WHERE name=:name AND expires_at > :now");
+        prepare(Statement::AddMiss, R"xxx(INSERT INTO word_miss (name, reason, expires_at)
+                                          VALUES (?, ?, ?)
+                                          ON CONFLICT (name) DO UPDATE SET
+                                              reason=excluded.reason, expires_at=excluded.expires_at;
+                                    )xxx");
+        prepare(Statement::PruneMisses, R"xxx(DELETE FROM word_miss
+                                              WHERE expires_at <= :now OR name IN (
+                                                  SELECT name FROM word_miss
+                                                  ORDER BY expires_at DESC
+                                                  LIMIT -1 OFFSET :limit);
+                                        )xxx");
+
+        mConnectionPool.setStatements(statementsSql);
+    }
+
+    auto WordDao::leaseConnection() -> WordConnectionPool::Lease {
+        if (QThread::currentThread() == mOwnerThread) {
+            return {};
+        }
+
+        return mConnectionPool.acquire();
+    }
+
+    auto WordDao::statement(Statement type) -> QSqlQuery* {
+        if (QThread::currentThread() == mOwnerThread) {
+            return &mStatements[static_cast<std::size_t>(type)];
+        }
+
+        return mConnectionPool.statement(static_cast<qsizetype>(type));
+    }
+
+    auto WordDao::connection() -> QSqlDatabase {
+        if (QThread::currentThread() == mOwnerThread) {
+            return mDatabase;
+        }
+
+        return mConnectionPool.database();
     }
 
     bool WordDao::checkIfExists(const QString& name) {
         bool success = false;
 
-        mSqlQuery.prepare("SELECT COUNT(*) FROM word WHERE name=?");
-        mSqlQuery.addBindValue(name);
+        QSqlQuery* query = statement(Statement::CheckIfExists);
 
-        if (!mSqlQuery.exec() || !mSqlQuery.first()) {
-           qWarning() << TAG << "check if exists `word` failed:  " << mSqlQuery.lastError();
-        } else if (mSqlQuery.value(0) == 0) {
+        if (query == nullptr) {
+            qWarning() << TAG << NO_CONNECTION_ERROR << Qt::endl;
+            return success;
+        }
+
+        query->addBindValue(name);
+
+        if (!query->exec() || !query->first()) {
+           qWarning() << TAG << "check if exists `word` failed:  " << query->lastError();
+        } else if (query->value(0) == 0) {
             success = false;
         } else {
            success = true;
         }
 
+        query->finish();
+
         return success;
     }
 
@@ -129,130 +882,297 @@ namespace grunwald {
     }
 
     auto WordDao::add(const Word& word) -> Result<void, DbError> {
-        int lastWordImageId = -1;
+        Result<void, DbError> result = insert(word);
 
-        if (word.hasImage()) {
-            mSqlQuery.prepare(R"xxx(INSERT INTO word_image (url, width, height, data)
-                                    VALUES (?, ?, ?, ?);
-                              )xxx");
+        if (!result.hasError()) {
+            qInfo() << TAG << "Add " << word.name << " into `word` table success!" << Qt::endl;
+        }
+
+        return result;
+    }
+
+    auto WordDao::update(const Word& word) -> Result<void, DbError> {
+        Result<void, DbError> result = modify(word);
+
+        if (!result.hasError()) {
+            qInfo() << TAG << "Update " << word.name << " into `word` table success!" << Qt::endl;
+        }
+
+        return result;
+    }
+
+    auto WordDao::addBatch(QSpan<const Word> words) -> QVector<Result<void, DbError>> {
+        QVector<Result<void, DbError>> results = executeBatch(words.size(), [this, words](qsizetype index) {
+            return insert(words[index]);
+        });
+
+        qInfo() << TAG << "Add batch of " << words.size() << " words into `word` table finished!" << Qt::endl;
+
+        return results;
+    }
+
+    auto WordDao::applyBatch(QSpan<const WordChange> changes) -> QVector<Result<void, DbError>> {
+        QVector<Result<void, DbError>> results = executeBatch(changes.size(), [this, changes](qsizetype index) {
+            const WordChange& change = changes[index];
 
-            mSqlQuery.addBindValue(word.image.url.toString());
-            mSqlQuery.addBindValue(word.image.width);
-            mSqlQuery.addBindValue(word.image.height);
-            mSqlQuery.addBindValue(word.image.data);
+            return change.type == WordChange::Type::Add ? insert(change.word) : remove(change.word);
+        });
 
-            if (!mSqlQuery.exec()) {
-                const QSqlError sqlError = mSqlQuery.lastError();
+        qInfo() << TAG << "Apply batch of " << changes.size() << " changes to `word` table finished!" << Qt::endl;
 
-                qWarning() << TAG << "Add `word_image` error:  " << sqlError;
+        return results;
+    }
+
+    auto WordDao::updateBatch(QSpan<const Word> words) -> QVector<Result<void, DbError>> {
+        QVector<Result<void, DbError>> results = executeBatch(words.size(), [this, words](qsizetype index) {
+            return modify(words[index]);
+        });
+
+        qInfo() << TAG << "Update batch of " << words.size() << " words into `word` table finished!" << Qt::endl;
+
+        return results;
+    }
+
+    auto WordDao::executeBatch(qsizetype count, const Operation& operation) -> QVector<Result<void, DbError>> {
+        QVector<Result<void, DbError>> results;
+        results.reserve(count);
+
+        if (QThread::currentThread() != mOwnerThread) {
+            qWarning() << TAG << NO_CONNECTION_ERROR << Qt::endl;
+
+            results.fill(DbError { NO_CONNECTION_ERROR }, count);
+            return results;
+        }
+
+        if (!mDatabase.transaction()) {
+            const QSqlError sqlError = mDatabase.lastError();
+            qWarning() << TAG << "Begin batch transaction error: " << sqlError;
+
+            results.fill(DbError { sqlError.text() , static_cast<qint32>(sqlError.type()) }, count);
+            return results;
+        }
+
+        /*
+         * Every row runs inside its own savepoint, so a failed row is rolled back
+         * alone and the rest of the batch is still committed with a single sync.
+         */
+        for (qsizetype i = 0; i < count; ++i) {
+            mSqlQuery.exec("SAVEPOINT batch_row");
+
+            Result<void, DbError> result = operation(i);
+
+            if (result.hasError()) {
+                mSqlQuery.exec("ROLLBACK TO batch_row");
+            }
+
+            mSqlQuery.exec("RELEASE batch_row");
+            results.push_back(std::move(result));
+        }
+
+        if (!mDatabase.commit()) {
+            const QSqlError sqlError = mDatabase.lastError();
+            qWarning() << TAG << "Commit batch transaction error: " << sqlError;
+
+            mDatabase.rollback();
+            results.fill(DbError { sqlError.text() , static_cast<qint32>(sqlError.type()) }, count);
+        }
+
+        return results;
+    }
+
+    auto WordDao::encodeText(const QString& text) const -> QVariant {
+        if (mTextEncoding == TextEncoding::Compressed) {
+            return WordTextCodec::encode(text);
+        }
+
+        return text;
+    }
+
+    auto WordDao::storeImage(const WordImage& image) -> Result<qint64, DbError> {
+        /*
+         * Bytes weren't loaded with the word, so the stored image is unchanged.
+         */
+        if (image.data.isEmpty() && image.id > 0) {
+            return image.id;
+        }
+
+        QVariant hash = QVariant(QMetaType::fromType<QByteArray>());
+
+        if (!image.data.isEmpty()) {
+            hash = QCryptographicHash::hash(image.data, QCryptographicHash::Sha256);
+
+            QSqlQuery* findQuery = statement(Statement::FindImage);
+
+            if (findQuery == nullptr) {
+                qWarning() << TAG << NO_CONNECTION_ERROR << Qt::endl;
+                return DbError { NO_CONNECTION_ERROR };
+            }
+
+            findQuery->addBindValue(hash);
+
+            if (!findQuery->exec()) {
+                const QSqlError sqlError = findQuery->lastError();
+
+                qWarning() << TAG << "Find `word_image` error:  " << sqlError;
                 return DbError { sqlError.text() , static_cast<qint32>(sqlError.type()) };
             }
 
-            lastWordImageId = mSqlQuery.lastInsertId().toInt();
+            if (findQuery->next()) {
+                const qint64 imageId = findQuery->value(0).toLongLong();
+                findQuery->finish();
+
+                return imageId;
+            }
+
+            findQuery->finish();
         }
 
-        mSqlQuery.prepare(R"xxx(INSERT INTO word (
-                                    id_image, name, transcription, translation,
-                                    association, etymology, description,
-                                    type, date)
-                                VALUES (?, ?, ?, ?, ?, ?, ?, ?, ?);
-                          )xxx");
+        QSqlQuery* imageQuery = statement(Statement::AddImage);
 
-        mSqlQuery.addBindValue(lastWordImageId);
-        mSqlQuery.addBindValue(word.name);
-        mSqlQuery.addBindValue(word.transcription);
-        mSqlQuery.addBindValue(word.translation);
-        mSqlQuery.addBindValue(word.association);
-        mSqlQuery.addBindValue(word.etymology);
-        mSqlQuery.addBindValue(word.description);
-        mSqlQuery.addBindValue(static_cast<std::underlying_type_t<WordType>>(word.type));
-        mSqlQuery.addBindValue(word.date);
+        if (imageQuery == nullptr) {
+            qWarning() << TAG << NO_CONNECTION_ERROR << Qt::endl;
+            return DbError { NO_CONNECTION_ERROR };
+        }
 
-        if (!mSqlQuery.exec()) {
-            const QSqlError sqlError = mSqlQuery.lastError();
+        imageQuery->addBindValue(image.url.toString());
+        imageQuery->addBindValue(image.width);
+        imageQuery->addBindValue(image.height);
+        imageQuery->addBindValue(image.data);
+        imageQuery->addBindValue(hash);
+
+        if (!imageQuery->exec()) {
+            const QSqlError sqlError = imageQuery->lastError();
+
+            qWarning() << TAG << "Add `word_image` error:  " << sqlError;
+            return DbError { sqlError.text() , static_cast<qint32>(sqlError.type()) };
+        }
+
+        return imageQuery->lastInsertId().toLongLong();
+    }
+
+    auto WordDao::insert(const Word& word) -> Result<void, DbError> {
+        qint64 lastWordImageId = -1;
+
+        if (word.hasImage()) {
+            Result<qint64, DbError> imageResult = storeImage(word.image);
+
+            if (imageResult.hasError()) {
+                return imageResult.error();
+            }
+
+            lastWordImageId = imageResult.value();
+        }
+
+        QSqlQuery* updateQuery = statement(Statement::UpdateWordByName);
+        QSqlQuery* wordQuery = statement(Statement::AddWord);
+
+        if (updateQuery == nullptr || wordQuery == nullptr) {
+            qWarning() << TAG << NO_CONNECTION_ERROR << Qt::endl;
+            return DbError { NO_CONNECTION_ERROR };
+        }
+
+        updateQuery->addBindValue(lastWordImageId);
+        updateQuery->addBindValue(encodeText(word.transcription));
+        updateQuery->addBindValue(encodeText(word.translation));
+        updateQuery->addBindValue(encodeText(word.association));
+        updateQuery->addBindValue(encodeText(word.etymology));
+        updateQuery->addBindValue(encodeText(word.description));
+        updateQuery->addBindValue(static_cast<std::underlying_type_t<WordType>>(word.type));
+        updateQuery->addBindValue(word.date);
+        updateQuery->addBindValue(word.name);
+
+        if (!updateQuery->exec()) {
+            const QSqlError sqlError = updateQuery->lastError();
 
             qWarning() << TAG << "Add `word` error:  " << sqlError;
             return DbError { sqlError.text() , static_cast<qint32>(sqlError.type()) };
         }
 
-        qInfo() << TAG << "Add " << word.name << " into `word` table success!" << Qt::endl;
+        /*
+         * The headword is saved already.
+         */
+        if (updateQuery->numRowsAffected() > 0) {
+            return {};
+        }
+
+        wordQuery->addBindValue(lastWordImageId);
+        wordQuery->addBindValue(word.name);
+        wordQuery->addBindValue(WordNormalizer::toKey(word.name));
+        wordQuery->addBindValue(encodeText(word.transcription));
+        wordQuery->addBindValue(encodeText(word.translation));
+        wordQuery->addBindValue(encodeText(word.association));
+        wordQuery->addBindValue(encodeText(word.etymology));
+        wordQuery->addBindValue(encodeText(word.description));
+        wordQuery->addBindValue(static_cast<std::underlying_type_t<WordType>>(word.type));
+        wordQuery->addBindValue(word.date);
+
+        if (!wordQuery->exec()) {
+            const QSqlError sqlError = wordQuery->lastError();
+
+            qWarning() << TAG << "Add `word` error:  " << sqlError;
+            return DbError { sqlError.text() , static_cast<qint32>(sqlError.type()) };
+        }
 
         return {};
     }
 
-    auto WordDao::update(const Word& word) -> Result<void, DbError> {
-        int lastWordImageId = -1;
+    auto WordDao::modify(const Word& word) -> Result<void, DbError> {
+        qint64 lastWordImageId = -1;
 
         if (word.hasImage()) {
-            mSqlQuery.prepare(R"xxx(UPDATE word_image SET
-                                        url=?, width=?, height=?, data=?
-                                    WHERE id=?;
-                              )xxx");
-
-            mSqlQuery.addBindValue(word.image.url.toString());
-            mSqlQuery.addBindValue(word.image.width);
-            mSqlQuery.addBindValue(word.image.height);
-            mSqlQuery.addBindValue(word.image.data);
-            mSqlQuery.addBindValue(word.image.id);
+            Result<qint64, DbError> imageResult = storeImage(word.image);
 
-            if (!mSqlQuery.exec()) {
-                const QSqlError sqlError = mSqlQuery.lastError();
-
-                qWarning() << TAG << "Update `word_image` error:  " << sqlError;
-                return DbError { sqlError.text() , static_cast<qint32>(sqlError.type()) };
+            if (imageResult.hasError()) {
+                return imageResult.error();
             }
 
-            lastWordImageId = mSqlQuery.lastInsertId().toInt();
+            lastWordImageId = imageResult.value();
         }
 
-        mSqlQuery.prepare(R"xxx(UPDATE word SET
-                                    id_image=?, name=?, transcription=?, translation=?,
-                                    association=?, etymology=?, description=?,
-                                    type=?, date=?
-                                WHERE id=?;
-                          )xxx");
+        QSqlQuery* wordQuery = statement(Statement::UpdateWord);
 
-        mSqlQuery.addBindValue(lastWordImageId);
-        mSqlQuery.addBindValue(word.name);
-        mSqlQuery.addBindValue(word.transcription);
-        mSqlQuery.addBindValue(word.translation);
-        mSqlQuery.addBindValue(word.association);
-        mSqlQuery.addBindValue(word.etymology);
-        mSqlQuery.addBindValue(word.description);
-        mSqlQuery.addBindValue(static_cast<std::underlying_type_t<WordType>>(word.type));
-        mSqlQuery.addBindValue(word.date);
-        mSqlQuery.addBindValue(word.id);
+        if (wordQuery == nullptr) {
+            qWarning() << TAG << NO_CONNECTION_ERROR << Qt::endl;
+            return DbError { NO_CONNECTION_ERROR };
+        }
 
-        if (!mSqlQuery.exec()) {
-            const QSqlError sqlError = mSqlQuery.lastError();
+        wordQuery->addBindValue(lastWordImageId);
+        wordQuery->addBindValue(word.name);
+        wordQuery->addBindValue(WordNormalizer::toKey(word.name));
+        wordQuery->addBindValue(encodeText(word.transcription));
+        wordQuery->addBindValue(encodeText(word.translation));
+        wordQuery->addBindValue(encodeText(word.association));
+        wordQuery->addBindValue(encodeText(word.etymology));
+        wordQuery->addBindValue(encodeText(word.description));
+        wordQuery->addBindValue(static_cast<std::underlying_type_t<WordType>>(word.type));
+        wordQuery->addBindValue(word.date);
+        wordQuery->addBindValue(word.id);
+
+        if (!wordQuery->exec()) {
+            const QSqlError sqlError = wordQuery->lastError();
 
             qWarning() << TAG << "Update `word` error:  " << sqlError;
             return DbError { sqlError.text() , static_cast<qint32>(sqlError.type()) };
         }
 
-        qInfo() << TAG << "Update " << word.name << " into `word` table success!" << Qt::endl;
-
         return {};
     }
 
     auto WordDao::remove(const Word& word) -> Result<void, DbError> {
-        if (word.hasImage()) {
-            mSqlQuery.prepare("DELETE FROM word_image WHERE id=?;");
-            mSqlQuery.addBindValue(word.image.id);
+        QSqlQuery* wordQuery = statement(Statement::RemoveWord);
 
-            if (!mSqlQuery.exec()) {
-                const QSqlError sqlError = mSqlQuery.lastError();
-
-                qWarning() << TAG << "Delete `word_image` error: " << sqlError;
-                return DbError { sqlError.text() , static_cast<qint32>(sqlError.type()) };
-            }
+        if (wordQuery == nullptr) {
+            qWarning() << TAG << NO_CONNECTION_ERROR << Qt::endl;
+            return DbError { NO_CONNECTION_ERROR };
         }
 
-        mSqlQuery.prepare("DELETE FROM word WHERE id=?;");
-        mSqlQuery.addBindValue(word.id);
+        /*
+         * By name, so a word removed before its queued insert reported an id is still found.
+         */
+        wordQuery->addBindValue(word.name);
 
-        if (!mSqlQuery.exec()) {
-            const QSqlError sqlError = mSqlQuery.lastError();
+        if (!wordQuery->exec()) {
+            const QSqlError sqlError = wordQuery->lastError();
 
             qWarning() << TAG << "Delete `word` error:  " << sqlError;
             return DbError { sqlError.text() , static_cast<qint32>(sqlError.type()) };
@@ -263,139 +1183,434 @@ namespace grunwald {
         return {};
     }
 
-    auto WordDao::prepareWord() -> Word {
+    auto WordDao::prepareWord(const QSqlQuery& query, bool withImageData) -> Word {
         return Word {
-            .id = mSqlQuery.value(mSqlRecord.indexOf("word_id")).toInt(),
-            .name = mSqlQuery.value(mSqlRecord.indexOf("name")).toString(),
-            .transcription = mSqlQuery.value(mSqlRecord.indexOf("transcription")).toString(),
-            .translation = mSqlQuery.value(mSqlRecord.indexOf("translation")).toString(),
-            .association = mSqlQuery.value(mSqlRecord.indexOf("association")).toString(),
-            .etymology = mSqlQuery.value(mSqlRecord.indexOf("etymology")).toString(),
-            .description = mSqlQuery.value(mSqlRecord.indexOf("description")).toString(),
-            .type = static_cast<WordType>(mSqlQuery.value(mSqlRecord.indexOf("type")).toInt()),
+            .id = query.value(columnIndex(WordColumn::Id)).toInt(),
+            .name = query.value(columnIndex(WordColumn::Name)).toString(),
+            .transcription = WordTextCodec::decode(query.value(columnIndex(WordColumn::Transcription))),
+            .translation = WordTextCodec::decode(query.value(columnIndex(WordColumn::Translation))),
+            .association = WordTextCodec::decode(query.value(columnIndex(WordColumn::Association))),
+            .etymology = WordTextCodec::decode(query.value(columnIndex(WordColumn::Etymology))),
+            .description = WordTextCodec::decode(query.value(columnIndex(WordColumn::Description))),
+            .type = static_cast<WordType>(query.value(columnIndex(WordColumn::Type)).toInt()),
             .image = WordImage {
-                .id = mSqlQuery.value(mSqlRecord.indexOf("image_id")).toInt(),
-                .url = mSqlQuery.value(mSqlRecord.indexOf("image_url")).toUrl(),
-                .width = mSqlQuery.value(mSqlRecord.indexOf("image_width")).toInt(),
-                .height = mSqlQuery.value(mSqlRecord.indexOf("image_height")).toInt(),
-                .data = mSqlQuery.value(mSqlRecord.indexOf("image_data")).toByteArray(),
+                .id = query.value(columnIndex(WordColumn::ImageId)).toInt(),
+                .url = query.value(columnIndex(WordColumn::ImageUrl)).toUrl(),
+                .width = query.value(columnIndex(WordColumn::ImageWidth)).toInt(),
+                .height = query.value(columnIndex(WordColumn::ImageHeight)).toInt(),
+                .data = withImageData ? query.value(columnIndex(WordColumn::ImageData)).toByteArray() : QByteArray{},
             },
-            .date = mSqlQuery.value(mSqlRecord.indexOf("date")).toDateTime(),
+            .date = query.value(columnIndex(WordColumn::Date)).toDateTime(),
         };
     }
 
     auto WordDao::get(qint32 id) -> Result<Word, DbError> {
-        mSqlQuery.prepare(R"xxx(SELECT word.id AS word_id,
-                                       word.name AS name,
-                                       word.transcription AS transcription,
-                                       word.translation AS translation,
-                                       word.association AS association,
-                                       word.etymology AS etymology,
-                                       word.description AS description,
-                                       word.type AS type,
-                                       word.date AS date,
-                                       word_image.id AS image_id,
-                                       word_image.url AS image_url,
-                                       word_image.width AS image_width,
-                                       word_image.height AS image_height,
-                                       word_image.data AS image_data
-                                FROM word
-                                LEFT JOIN word_image ON word.id = word_image.id
-                                WHERE word.id=?)xxx");
-        mSqlQuery.addBindValue(id);
+        QSqlQuery* query = statement(Statement::Get);
 
-        if (!mSqlQuery.exec()) {
-            const QSqlError sqlError = mSqlQuery.lastError();
+        if (query == nullptr) {
+            qWarning() << TAG << NO_CONNECTION_ERROR << Qt::endl;
+            return DbError { NO_CONNECTION_ERROR };
+        }
+
+        query->addBindValue(id);
+
+        if (!query->exec()) {
+            const QSqlError sqlError = query->lastError();
 
             qWarning() << TAG << "Select `word` error: " << id << "," << sqlError;
             return DbError { sqlError.text() , static_cast<qint32>(sqlError.type()) };
         }
 
-        mSqlRecord = mSqlQuery.record();
+        if (query->next()) {
+            Word word = prepareWord(*query, true);
+            query->finish();
 
-        if (mSqlQuery.next()) {
             qInfo() << TAG << "Get by id=" << id << " from `word` table success!" << Qt::endl;
-            return prepareWord();
+            return word;
         }
 
+        query->finish();
+
         return {};
     }
 
     auto WordDao::getAll() -> Result<QVector<Word>, DbError> {
         QVector<Word> words;
-        Word word = {};
-
-        if (!mSqlQuery.exec(R"xxx(SELECT word.id AS word_id,
-                                       word.name AS name,
-                                       word.transcription AS transcription,
-                                       word.translation AS translation,
-                                       word.association AS association,
-                                       word.etymology AS etymology,
-                                       word.description AS description,
-                                       word.type AS type,
-                                       word.date AS date,
-                                       word_image.id AS image_id,
-                                       word_image.url AS image_url,
-                                       word_image.width AS image_width,
-                                       word_image.height AS image_height,
-                                       word_image.data AS image_data
-                                FROM word
-                                LEFT JOIN word_image ON word.id = word_image.id)xxx")) {
-            const QSqlError sqlError = mSqlQuery.lastError();
+
+        QSqlQuery* query = statement(Statement::GetAll);
+
+        if (query == nullptr) {
+            qWarning() << TAG << NO_CONNECTION_ERROR << Qt::endl;
+            return DbError { NO_CONNECTION_ERROR };
+        }
+
+        if (!query->exec()) {
+            const QSqlError sqlError = query->lastError();
 
             qWarning() << TAG << "Select all `word`s error: " << sqlError;
             return DbError { sqlError.text() , static_cast<qint32>(sqlError.type()) };
         }
 
-        mSqlRecord = mSqlQuery.record();
-
-        while (mSqlQuery.next()) {
-            words.push_back(prepareWord());
+        while (query->next()) {
+            words.push_back(prepareWord(*query, false));
         }
 
+        query->finish();
+
         qInfo() << TAG << "Get all from `word` table success!" << Qt::endl;
 
         return words;
     }
 
+    auto WordDao::getNames() -> Result<QStringList, DbError> {
+        QStringList names;
+
+        QSqlQuery* query = statement(Statement::GetNames);
+
+        if (query == nullptr) {
+            qWarning() << TAG << NO_CONNECTION_ERROR << Qt::endl;
+            return DbError { NO_CONNECTION_ERROR };
+        }
+
+        if (!query->exec()) {
+            const QSqlError sqlError = query->lastError();
+
+            qWarning() << TAG << "Select `word` names error: " << sqlError;
+            return DbError { sqlError.text() , static_cast<qint32>(sqlError.type()) };
+        }
+
+        while (query->next()) {
+            names.push_back(query->value(0).toString());
+        }
+
+        query->finish();
+
+        return names;
+    }
+
     auto WordDao::search(const QString& name) -> Result<QVector<Word>, DbError> {
         QVector<Word> words;
-        Word word = {};
-
-        mSqlQuery.prepare(R"xxx(SELECT word.id AS word_id,
-                                       word.name AS name,
-                                       word.transcription AS transcription,
-                                       word.translation AS translation,
-                                       word.association AS association,
-                                       word.etymology AS etymology,
-                                       word.description AS description,
-                                       word.type AS type,
-                                       word.date AS date,
-                                       word_image.id AS image_id,
-                                       word_image.url AS image_url,
-                                       word_image.width AS image_width,
-                                       word_image.height AS image_height,
-                                       word_image.data AS image_data
-                                FROM word
-                                LEFT JOIN word_image ON word.id = word_image.id
-                                WHERE word.name = :word_name)xxx");
-        mSqlQuery.bindValue(":word_name", name);
 
-        if (!mSqlQuery.exec()) {
-            const QSqlError sqlError = mSqlQuery.lastError();
+        QSqlQuery* query = statement(Statement::Search);
+
+        if (query == nullptr) {
+            qWarning() << TAG << NO_CONNECTION_ERROR << Qt::endl;
+            return DbError { NO_CONNECTION_ERROR };
+        }
+
+        query->bindValue(":name_key", WordNormalizer::toKey(name));
+
+        if (!query->exec()) {
+            const QSqlError sqlError = query->lastError();
 
             qWarning() << TAG << "Search `word`s error: " << sqlError;
             return DbError { sqlError.text() , static_cast<qint32>(sqlError.type()) };
         }
 
-        mSqlRecord = mSqlQuery.record();
-
-        while (mSqlQuery.next()) {
-            words.push_back(prepareWord());
+        while (query->next()) {
+            words.push_back(prepareWord(*query, false));
         }
 
+        query->finish();
+
+        /*
+         * Different headwords may share the key, the one spelled as searched comes first.
+         */
+        std::stable_partition(words.begin(), words.end(), [&name](const Word& word) {
+            return word.name == name;
+        });
+
         qInfo() << TAG << "Search " << name << " into `word` table success!" << Qt::endl;
 
         return words;
     }
+        
+    auto WordDao::fullTextSearch(const QString& text, qint32 limit) -> Result<QVector<Word>, DbError> {
+        QVector<Word> words;
+
+        const QString fullTextQuery = prepareFullTextQuery(text);
+
+        if (fullTextQuery.isEmpty()) {
+            return words;
+        }
+
+        QSqlQuery* query = statement(Statement::FullTextSearch);
+
+        if (query == nullptr) {
+            qWarning() << TAG << NO_CONNECTION_ERROR << Qt::endl;
+            return DbError { NO_CONNECTION_ERROR };
+        }
+
+        query->bindValue(":query", fullTextQuery);
+        query->bindValue(":limit", limit);
+
+        if (!query->exec()) {
+            const QSqlError sqlError = query->lastError();
+
+            qWarning() << TAG << "Full text search `word`s error: " << sqlError;
+            return DbError { sqlError.text() , static_cast<qint32>(sqlError.type()) };
+        }
+
+        while (query->next()) {
+            words.push_back(prepareWord(*query, false));
+        }
+
+        query->finish();
+
+        qInfo() << TAG << "Full text search " << text << " into `word_fts` table success!" << Qt::endl;
+
+        return words;
+    }
+
+    auto WordDao::loadImageData(qint64 imageId) -> Result<QByteArray, DbError> {
+        QSqlQuery* query = statement(Statement::LoadImageData);
+
+        if (query == nullptr) {
+            qWarning() << TAG << NO_CONNECTION_ERROR << Qt::endl;
+            return DbError { NO_CONNECTION_ERROR };
+        }
+
+        query->addBindValue(imageId);
+
+        if (!query->exec()) {
+            const QSqlError sqlError = query->lastError();
+
+            qWarning() << TAG << "Load `word_image` data error: " << imageId << "," << sqlError;
+            return DbError { sqlError.text() , static_cast<qint32>(sqlError.type()) };
+        }
+
+        QByteArray imageData;
+
+        if (query->next()) {
+            imageData = query->value(0).toByteArray();
+        }
+
+        query->finish();
+
+        return imageData;
+    }
+
+    auto WordDao::openImageStream(qint64 imageId) -> Result<std::unique_ptr<QIODevice>, DbError> {
+        QSqlDatabase database = connection();
+
+        if (!database.isValid()) {
+            qWarning() << TAG << NO_CONNECTION_ERROR << Qt::endl;
+            return DbError { NO_CONNECTION_ERROR };
+        }
+
+        /*
+         * Without direct SQLite access the bytes are read whole through the driver.
+         */
+        if (sqliteHandle(database) == nullptr) {
+            Result<QByteArray, DbError> imageData = loadImageData(imageId);
+
+            if (imageData.hasError()) {
+                return imageData.error();
+            }
+
+            auto buffer = std::make_unique<QBuffer>();
+            buffer->setData(std::move(imageData).value());
+            buffer->open(QIODevice::ReadOnly);
+
+            return std::unique_ptr<QIODevice>(std::move(buffer));
+        }
+
+        auto device = std::make_unique<WordBlobDevice>(database, "word_image", "data", imageId);
+
+        if (!device->open(QIODevice::ReadOnly)) {
+            qWarning() << TAG << "Open `word_image` data stream error: " << imageId << "," << device->errorString();
+            return DbError { device->errorString() };
+        }
+
+        return std::unique_ptr<QIODevice>(std::move(device));
+    }
+
+    auto WordDao::findMiss(const QString& name) -> Result<std::optional<WordMiss>, DbError> {
+        QSqlQuery* query = statement(Statement::FindMiss);
+
+        if (query == nullptr) {
+            qWarning() << TAG << NO_CONNECTION_ERROR << Qt::endl;
+            return DbError { NO_CONNECTION_ERROR };
+        }
+
+        query->bindValue(":name", name);
+        query->bindValue(":now", QDateTime::currentMSecsSinceEpoch());
+
+        if (!query->exec()) {
+            const QSqlError sqlError = query->lastError();
+
+            qWarning() << TAG << "Select `word_miss` error: " << sqlError;
+            return DbError { sqlError.text() , static_cast<qint32>(sqlError.type()) };
+        }
+
+        std::optional<WordMiss> miss;
+
+        if (query->next()) {
+            miss = WordMiss {
+                .name = name,
+                .reason = query->value(0).toInt(),
+                .expiresAt = QDateTime::fromMSecsSinceEpoch(query->value(1).toLongLong()),
+            };
+        }
+
+        query->finish();
+
+        return miss;
+    }
+
+    auto WordDao::addMiss(const WordMiss& miss, qint32 limit) -> Result<void, DbError> {
+        QSqlQuery* addQuery = statement(Statement::AddMiss);
+        QSqlQuery* pruneQuery = statement(Statement::PruneMisses);
+
+        if (addQuery == nullptr || pruneQuery == nullptr) {
+            qWarning() << TAG << NO_CONNECTION_ERROR << Qt::endl;
+            return DbError { NO_CONNECTION_ERROR };
+        }
+
+        addQuery->addBindValue(miss.name);
+        addQuery->addBindValue(miss.reason);
+        addQuery->addBindValue(miss.expiresAt.toMSecsSinceEpoch());
+
+        if (!addQuery->exec()) {
+            const QSqlError sqlError = addQuery->lastError();
+
+            qWarning() << TAG << "Insert `word_miss` error:  " << sqlError;
+            return DbError { sqlError.text() , static_cast<qint32>(sqlError.type()) };
+        }
+
+        pruneQuery->bindValue(":now", QDateTime::currentMSecsSinceEpoch());
+        pruneQuery->bindValue(":limit", limit);
+
+        if (!pruneQuery->exec()) {
+            const QSqlError sqlError = pruneQuery->lastError();
+
+            qWarning() << TAG << "Prune `word_miss` error:  " << sqlError;
+            return DbError { sqlError.text() , static_cast<qint32>(sqlError.type()) };
+        }
+
+        qInfo() << TAG << "Remember " << miss.name << " into `word_miss` table until " << miss.expiresAt << Qt::endl;
+
+        return {};
+    }
+
+    auto WordDao::optimize() -> Result<void, DbError> {
+        if (QThread::currentThread() != mOwnerThread) {
+            qWarning() << TAG << NO_CONNECTION_ERROR << Qt::endl;
+            return DbError { NO_CONNECTION_ERROR };
+        }
+
+        if (!mSqlQuery.exec("PRAGMA optimize")) {
+            const QSqlError sqlError = mSqlQuery.lastError();
+
+            qWarning() << TAG << "Optimize database error: " << sqlError;
+            return DbError { sqlError.text() , static_cast<qint32>(sqlError.type()) };
+        }
+
+        mSqlQuery.finish();
+
+        return {};
+    }
+
+    auto WordDao::analyze() -> Result<void, DbError> {
+        if (QThread::currentThread() != mOwnerThread) {
+            qWarning() << TAG << NO_CONNECTION_ERROR << Qt::endl;
+            return DbError { NO_CONNECTION_ERROR };
+        }
+
+        if (!mSqlQuery.exec(QString("PRAGMA analysis_limit = %1").arg(ANALYSIS_LIMIT)) || !mSqlQuery.exec("ANALYZE")) {
+            const QSqlError sqlError = mSqlQuery.lastError();
+
+            qWarning() << TAG << "Analyze database error: " << sqlError;
+            return DbError { sqlError.text() , static_cast<qint32>(sqlError.type()) };
+        }
+
+        return {};
+    }
+
+    auto WordDao::incrementalVacuum(qint32 maxPages) -> Result<VacuumStats, DbError> {
+        if (QThread::currentThread() != mOwnerThread) {
+            qWarning() << TAG << NO_CONNECTION_ERROR << Qt::endl;
+            return DbError { NO_CONNECTION_ERROR };
+        }
+
+        const qint64 pageSize = pragmaValue("page_size");
+        const qint64 freePagesBefore = pragmaValue("freelist_count");
+
+        /*
+         * Without incremental auto vacuum the pragma frees nothing, there is no work to resume.
+         */
+        if (freePagesBefore <= 0 || pragmaValue("auto_vacuum") != INCREMENTAL_VACUUM) {
+            return VacuumStats { 0, 0 };
+        }
+
+        /*
+         * The pragma frees one page per step and returns no columns, QSqlQuery steps
+         * such statements only once, so it runs through sqlite3_exec() to completion.
+         * Without direct SQLite access every page is freed by its own statement.
+         */
+        sqlite3* handle = sqliteHandle(mDatabase);
+
+        if (handle == nullptr) {
+            for (qint64 page = 0; page < qMin<qint64>(maxPages, freePagesBefore); ++page) {
+                if (!mSqlQuery.exec("PRAGMA incremental_vacuum(1)")) {
+                    const QSqlError sqlError = mSqlQuery.lastError();
+
+                    qWarning() << TAG << "Incremental vacuum error: " << sqlError;
+                    return DbError { sqlError.text() , static_cast<qint32>(sqlError.type()) };
+                }
+            }
+
+            const qint64 freePagesAfter = pragmaValue("freelist_count");
+
+            return VacuumStats { (freePagesBefore - freePagesAfter) * pageSize, freePagesAfter };
+        }
+
+        const QByteArray vacuumSql = QString("PRAGMA incremental_vacuum(%1)").arg(maxPages).toUtf8();
+        char* errorMessage = nullptr;
+
+        if (sqlite3_exec(handle, vacuumSql.constData(), nullptr, nullptr, &errorMessage) != SQLITE_OK) {
+            const QString vacuumError = QString::fromUtf8(errorMessage);
+            sqlite3_free(errorMessage);
+
+            qWarning() << TAG << "Incremental vacuum error: " << vacuumError;
+            return DbError { vacuumError };
+        }
+
+        const qint64 freePagesAfter = pragmaValue("freelist_count");
+
+        return VacuumStats { (freePagesBefore - freePagesAfter) * pageSize, freePagesAfter };
+    }
+
+    auto WordDao::page(const QString& afterName, qint64 afterId, qint32 limit) -> Result<QVector<Word>, DbError> {
+        QVector<Word> words;
+        words.reserve(limit);
+
+        QSqlQuery* query = statement(Statement::Page);
+
+        if (query == nullptr) {
+            qWarning() << TAG << NO_CONNECTION_ERROR << Qt::endl;
+            return DbError { NO_CONNECTION_ERROR };
+        }
+
+        query->bindValue(":after_name", afterName);
+        query->bindValue(":after_id", afterId);
+        query->bindValue(":limit", limit);
+
+        if (!query->exec()) {
+            const QSqlError sqlError = query->lastError();
+
+            qWarning() << TAG << "Select page of `word`s error: " << sqlError;
+            return DbError { sqlError.text() , static_cast<qint32>(sqlError.type()) };
+        }
+
+        while (query->next()) {
+            words.push_back(prepareWord(*query, false));
+        }
+
+        query->finish();
+
+        qInfo() << TAG << "Get page after " << afterName << " from `word` table success!" << Qt::endl;
+
+        return words;
+    }
 }
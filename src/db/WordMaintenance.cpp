@@ -0,0 +1,209 @@
+/*
+ * Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+ * SPDX-License-Identifier: MIT
+ * Copyright (c) 2023-2025 https://github.com/klappdev
+ *
+ * Permission is hereby  granted, free of charge, to any  person obtaining a copy
+ * of this software and associated  documentation files (the "Software"), to deal
+ * in the Software  without restriction, including without  limitation the rights
+ * to  use, copy,  modify, merge,  publish, distribute,  sublicense, and/or  sell
+ * copies  of  the Software,  and  to  permit persons  to  whom  the Software  is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE  IS PROVIDED "AS  IS", WITHOUT WARRANTY  OF ANY KIND,  EXPRESS OR
+ * IMPLIED,  INCLUDING BUT  NOT  LIMITED TO  THE  WARRANTIES OF  MERCHANTABILITY,
+ * FITNESS FOR  A PARTICULAR PURPOSE AND  NONINFRINGEMENT. IN NO EVENT  SHALL THE
+ * AUTHORS  OR COPYRIGHT  HOLDERS  BE  LIABLE FOR  ANY  CLAIM,  DAMAGES OR  OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF  CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE  OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "db/WordMaintenance.hpp"
+
+#include <QCoreApplication>
+
+namespace {
+    constexpr const char* const TAG = "[WordMaintenance] ";
+
+    constexpr qint32 IDLE_CHECK_INTERVAL_MS = 10 * 1000;
+    constexpr qint64 IDLE_TIMEOUT_MS = 60 * 1000;
+    constexpr qint64 PASS_INTERVAL_MS = 60 * 60 * 1000;
+
+    /*
+     * Time a single step may keep the database thread busy,
+     * vacuum chunks grow or shrink to stay close to it.
+     */
+    constexpr qint64 STEP_BUDGET_MS = 50;
+
+    /*
+     * Pause between steps, so queued events and lookups run before the next chunk.
+     */
+    constexpr qint32 STEP_INTERVAL_MS = 100;
+
+    constexpr qint32 MIN_VACUUM_PAGES = 16;
+    constexpr qint32 MAX_VACUUM_PAGES = 4096;
+    constexpr qint32 DEFAULT_VACUUM_PAGES = 256;
+}
+
+namespace grunwald {
+
+    WordMaintenance::WordMaintenance(AsyncWordDao* wordDao, QObject* parent)
+        : QObject(parent)
+        , mWordDao(wordDao)
+        , mNextPassDeadline(0)
+        , mStep(Step::None)
+        , mStepRunning(false)
+        , mVacuumPages(DEFAULT_VACUUM_PAGES)
+        , mReclaimedBytes(0)
+        , mElapsedMs(0) {
+        mActivityTimer.start();
+
+        QCoreApplication::instance()->installEventFilter(this);
+
+        QObject::connect(&mIdleTimer, &QTimer::timeout, this, &WordMaintenance::onIdleCheck);
+        mIdleTimer.start(IDLE_CHECK_INTERVAL_MS);
+
+        mStepTimer.setSingleShot(true);
+        mStepTimer.setInterval(STEP_INTERVAL_MS);
+        QObject::connect(&mStepTimer, &QTimer::timeout, this, &WordMaintenance::runStep);
+    }
+
+    WordMaintenance::~WordMaintenance() {
+        if (QCoreApplication::instance() != nullptr) {
+            QCoreApplication::instance()->removeEventFilter(this);
+        }
+    }
+
+    bool WordMaintenance::eventFilter(QObject* watched, QEvent* event) {
+        switch (event->type()) {
+        case QEvent::KeyPress:
+        case QEvent::MouseButtonPress:
+        case QEvent::MouseMove:
+        case QEvent::Wheel:
+        case QEvent::TouchBegin:
+        case QEvent::TouchUpdate:
+            mActivityTimer.restart();
+            break;
+        default:
+            break;
+        }
+
+        return QObject::eventFilter(watched, event);
+    }
+
+    bool WordMaintenance::isUserIdle() const {
+        return mActivityTimer.elapsed() >= IDLE_TIMEOUT_MS;
+    }
+
+    void WordMaintenance::onIdleCheck() {
+        if (mStepRunning || mStepTimer.isActive() || !isUserIdle()) {
+            return;
+        }
+
+        if (mStep != Step::None) {
+            runStep();
+        } else if (mNextPassDeadline.hasExpired()) {
+            startPass();
+        }
+    }
+
+    void WordMaintenance::startPass() {
+        qInfo() << TAG << "Start database maintenance" << Qt::endl;
+
+        mStep = Step::Optimize;
+        mReclaimedBytes = 0;
+        mElapsedMs = 0;
+
+        runStep();
+    }
+
+    void WordMaintenance::runStep() {
+        /*
+         * The pass is resumed from the same step by the next idle check.
+         */
+        if (!isUserIdle()) {
+            qDebug() << TAG << "Database maintenance paused by user activity" << Qt::endl;
+            return;
+        }
+
+        mStepRunning = true;
+
+        QElapsedTimer stepTimer;
+        stepTimer.start();
+
+        switch (mStep) {
+        case Step::Optimize:
+            mWordDao->optimize().then(this, [this, stepTimer](const Result<void, DbError>& result) {
+                if (result.hasError()) {
+                    qWarning() << TAG << "Optimize failed: " << result.error().getMessage() << Qt::endl;
+                }
+
+                finishStep(Step::Vacuum, stepTimer.elapsed());
+            });
+            break;
+
+        case Step::Vacuum:
+            mWordDao->incrementalVacuum(mVacuumPages).then(this, [this, stepTimer](const Result<WordDao::VacuumStats, DbError>& result) {
+                const qint64 stepElapsedMs = stepTimer.elapsed();
+
+                if (result.hasError()) {
+                    qWarning() << TAG << "Incremental vacuum failed: " << result.error().getMessage() << Qt::endl;
+
+                    finishStep(Step::Analyze, stepElapsedMs);
+                    return;
+                }
+
+                mReclaimedBytes += result.value().reclaimedBytes;
+
+                if (stepElapsedMs > STEP_BUDGET_MS) {
+                    mVacuumPages = qMax(MIN_VACUUM_PAGES, mVacuumPages / 2);
+                } else if (stepElapsedMs < STEP_BUDGET_MS / 2) {
+                    mVacuumPages = qMin(MAX_VACUUM_PAGES, mVacuumPages * 2);
+                }
+
+                finishStep(result.value().freePages > 0 ? Step::Vacuum : Step::Analyze, stepElapsedMs);
+            });
+            break;
+
+        case Step::Analyze:
+            mWordDao->analyze().then(this, [this, stepTimer](const Result<void, DbError>& result) {
+                if (result.hasError()) {
+                    qWarning() << TAG << "Analyze failed: " << result.error().getMessage() << Qt::endl;
+                }
+
+                finishStep(Step::None, stepTimer.elapsed());
+            });
+            break;
+
+        case Step::None:
+            mStepRunning = false;
+            break;
+        }
+    }
+
+    void WordMaintenance::finishStep(Step nextStep, qint64 stepElapsedMs) {
+        mStepRunning = false;
+        mElapsedMs += stepElapsedMs;
+        mStep = nextStep;
+
+        if (mStep == Step::None) {
+            finishPass();
+        } else {
+            /* runStep() checks idleness again once the timer fires */
+            mStepTimer.start();
+        }
+    }
+
+    void WordMaintenance::finishPass() {
+        mNextPassDeadline.setRemainingTime(PASS_INTERVAL_MS);
+
+        qInfo() << TAG << "Database maintenance finished, reclaimed " << mReclaimedBytes
+                << " bytes in " << mElapsedMs << " ms" << Qt::endl;
+
+        emit maintenanceFinished(mReclaimedBytes, mElapsedMs);
+    }
+}
@@ -0,0 +1,218 @@
+/*
+ * Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+ * SPDX-License-Identifier: MIT
+ * Copyright (c) 2023-2025 https://github.com/klappdev
+ *
+ * Permission is hereby  granted, free of charge, to any  person obtaining a copy
+ * of this software and associated  documentation files (the "Software"), to deal
+ * in the Software  without restriction, including without  limitation the rights
+ * to  use, copy,  modify, merge,  publish, distribute,  sublicense, and/or  sell
+ * copies  of  the Software,  and  to  permit persons  to  whom  the Software  is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE  IS PROVIDED "AS  IS", WITHOUT WARRANTY  OF ANY KIND,  EXPRESS OR
+ * IMPLIED,  INCLUDING BUT  NOT  LIMITED TO  THE  WARRANTIES OF  MERCHANTABILITY,
+ * FITNESS FOR  A PARTICULAR PURPOSE AND  NONINFRINGEMENT. IN NO EVENT  SHALL THE
+ * AUTHORS  OR COPYRIGHT  HOLDERS  BE  LIABLE FOR  ANY  CLAIM,  DAMAGES OR  OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF  CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE  OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "db/WordTextCodec.hpp"
+#include "db/SqliteHandle.hpp"
+
+#include <QtEndian>
+
+#include <algorithm>
+
+#include <zlib.h>
+
+namespace {
+    constexpr const char* const TAG = "[WordTextCodec] ";
+
+    constexpr char ENCODED_MAGIC[] = { '\0', 'W', 'T' };
+    constexpr char ENCODED_VERSION = 1;
+    constexpr qsizetype HEADER_SIZE = sizeof(ENCODED_MAGIC) + sizeof(ENCODED_VERSION) + sizeof(quint32);
+
+    /*
+     * Short values don't gain anything from compression.
+     */
+    constexpr qsizetype MIN_ENCODED_SIZE = 128;
+
+    /*
+     * Markup that repeats in every Wiktionary fragment, zlib looks it up
+     * as if it preceded the data, most frequent strings go last.
+     * Changing it requires a new ENCODED_VERSION.
+     */
+    constexpr char DICTIONARY[] =
+        "Proto-Indo-European Proto-Germanic Old High German Middle High German cognate with "
+        "Old English Old Norse Dutch English Latin from Ancient Greek "
+        "<span class=\"gender\"><abbr title=\"masculine gender\">m</abbr></span>"
+        "<span class=\"gender\"><abbr title=\"feminine gender\">f</abbr></span>"
+        "<span class=\"gender\"><abbr title=\"neuter gender\">n</abbr></span>"
+        "<span class=\"ib-brac qualifier-brac\">(</span><span class=\"ib-content qualifier-content\">"
+        "</span><span class=\"ib-brac qualifier-brac\">)</span>"
+        "<span class=\"mention-gloss-double-quote\">“</span><span class=\"mention-gloss\">"
+        "</span><span class=\"mention-gloss-double-quote\">”</span>"
+        "<span class=\"etyl\"><a rel=\"mw:WikiLink\" href=\"./Appendix:Glossary#"
+        "<i class=\"Latn mention\" lang=\"de\"><a rel=\"mw:WikiLink\" href=\"./"
+        "<span class=\"IPA\">/</span>"
+        "<span typeof=\"mw:Transclusion\" data-mw='{\"parts\":[{\"template\":{\"target\":{\"wt\":\""
+        "\"href\":\"./Template:\"},\"params\":{\"1\":{\"wt\":\"de\"},\"2\":{\"wt\":\""
+        "<p>From <li><ol></ol></li></p></i></span>"
+        "<a rel=\"mw:WikiLink\" href=\"./#German\" title=\"";
+
+    auto isEncoded(QByteArrayView data) -> bool {
+        return data.size() > HEADER_SIZE &&
+               data.first(sizeof(ENCODED_MAGIC)) == QByteArrayView(ENCODED_MAGIC, sizeof(ENCODED_MAGIC)) &&
+               data.at(sizeof(ENCODED_MAGIC)) == ENCODED_VERSION;
+    }
+
+    auto deflateText(QByteArrayView text) -> QByteArray {
+        z_stream stream{};
+
+        if (deflateInit(&stream, Z_BEST_COMPRESSION) != Z_OK) {
+            return {};
+        }
+
+        deflateSetDictionary(&stream, reinterpret_cast<const Bytef*>(DICTIONARY), sizeof(DICTIONARY) - 1);
+
+        QByteArray data;
+        data.resize(HEADER_SIZE + static_cast<qsizetype>(deflateBound(&stream, static_cast<uLong>(text.size()))));
+
+        std::copy_n(ENCODED_MAGIC, sizeof(ENCODED_MAGIC), data.data());
+        data[sizeof(ENCODED_MAGIC)] = ENCODED_VERSION;
+        qToBigEndian(static_cast<quint32>(text.size()), data.data() + sizeof(ENCODED_MAGIC) + sizeof(ENCODED_VERSION));
+
+        stream.next_in = reinterpret_cast<const Bytef*>(text.data());
+        stream.avail_in = static_cast<uInt>(text.size());
+        stream.next_out = reinterpret_cast<Bytef*>(data.data() + HEADER_SIZE);
+        stream.avail_out = static_cast<uInt>(data.size() - HEADER_SIZE);
+
+        const int status = deflate(&stream, Z_FINISH);
+        const qsizetype compressedSize = static_cast<qsizetype>(stream.total_out);
+
+        deflateEnd(&stream);
+
+        if (status != Z_STREAM_END) {
+            qWarning() << TAG << "Deflate text error: " << status << Qt::endl;
+            return {};
+        }
+
+        data.resize(HEADER_SIZE + compressedSize);
+
+        return data;
+    }
+
+    auto inflateText(QByteArrayView data) -> QByteArray {
+        const quint32 textSize = qFromBigEndian<quint32>(data.data() + sizeof(ENCODED_MAGIC) + sizeof(ENCODED_VERSION));
+
+        z_stream stream{};
+
+        if (inflateInit(&stream) != Z_OK) {
+            return {};
+        }
+
+        QByteArray text;
+        text.resize(textSize);
+
+        stream.next_in = reinterpret_cast<const Bytef*>(data.data() + HEADER_SIZE);
+        stream.avail_in = static_cast<uInt>(data.size() - HEADER_SIZE);
+        stream.next_out = reinterpret_cast<Bytef*>(text.data());
+        stream.avail_out = textSize;
+
+        int status = inflate(&stream, Z_FINISH);
+
+        if (status == Z_NEED_DICT) {
+            inflateSetDictionary(&stream, reinterpret_cast<const Bytef*>(DICTIONARY), sizeof(DICTIONARY) - 1);
+            status = inflate(&stream, Z_FINISH);
+        }
+
+        const bool completed = status == Z_STREAM_END && stream.total_out == textSize;
+
+        inflateEnd(&stream);
+
+        if (!completed) {
+            qWarning() << TAG << "Inflate text error: " << status << Qt::endl;
+            return {};
+        }
+
+        return text;
+    }
+
+    void decodeTextFunction(sqlite3_context* context, int, sqlite3_value** values) {
+        sqlite3_value* value = values[0];
+
+        if (sqlite3_value_type(value) != SQLITE_BLOB) {
+            sqlite3_result_value(context, value);
+            return;
+        }
+
+        const char* blob = static_cast<const char*>(sqlite3_value_blob(value));
+        const QByteArrayView data(blob, sqlite3_value_bytes(value));
+
+        if (!isEncoded(data)) {
+            sqlite3_result_value(context, value);
+            return;
+        }
+
+        const QByteArray text = inflateText(data);
+        sqlite3_result_text(context, text.constData(), static_cast<int>(text.size()), SQLITE_TRANSIENT);
+    }
+}
+
+namespace grunwald::WordTextCodec {
+
+    auto encode(const QString& text) -> QVariant {
+        const QByteArray utf8Text = text.toUtf8();
+
+        if (utf8Text.size() < MIN_ENCODED_SIZE) {
+            return text;
+        }
+
+        const QByteArray data = deflateText(utf8Text);
+
+        if (data.isEmpty() || data.size() >= utf8Text.size()) {
+            return text;
+        }
+
+        return data;
+    }
+
+    auto decode(const QVariant& value) -> QString {
+        if (value.typeId() != QMetaType::QByteArray) {
+            return value.toString();
+        }
+
+        const QByteArray data = value.toByteArray();
+
+        if (!isEncoded(data)) {
+            return QString::fromUtf8(data);
+        }
+
+        return QString::fromUtf8(inflateText(data));
+    }
+
+    bool registerFunctions(const QSqlDatabase& database) {
+        sqlite3* handle = sqliteHandle(database);
+
+        if (handle == nullptr) {
+            qWarning() << TAG << "Database connection hasn't SQLite handle" << Qt::endl;
+            return false;
+        }
+
+        const int status = sqlite3_create_function_v2(handle, "word_text", 1, SQLITE_UTF8 | SQLITE_DETERMINISTIC,
+                                                      nullptr, &decodeTextFunction, nullptr, nullptr, nullptr);
+
+        if (status != SQLITE_OK) {
+            qWarning() << TAG << "Function `word_text` was not registered: " << sqlite3_errmsg(handle) << Qt::endl;
+            return false;
+        }
+
+        return true;
+    }
+}
@@ -31,8 +31,10 @@ namespace {
 
 namespace grunwald {
 
-    AsyncWordImageProvider::AsyncWordImageProvider(WordCache* wordCache)
-        : mWordCache(wordCache) {
+    AsyncWordImageProvider::AsyncWordImageProvider(WordCache* wordCache, WordImageCache* imageCache, WordStorage* wordStorage)
+        : mWordCache(wordCache)
+        , mImageCache(imageCache)
+        , mWordStorage(wordStorage) {
     }
 
     AsyncWordImageProvider::~AsyncWordImageProvider() {
@@ -40,6 +42,6 @@ namespace grunwald {
     }
 
     QQuickImageResponse* AsyncWordImageProvider::requestImageResponse(const QString& imageId, const QSize& requestedSize) {
-        return new AsyncWordImageResponse{mWordCache, imageId, requestedSize};
+        return new AsyncWordImageResponse{mWordCache, mWordStorage, mImageCache, imageId, requestedSize};
     }
 }
@@ -34,14 +34,30 @@ namespace {
 
 namespace grunwald {
 
-    AsyncWordImageResponse::AsyncWordImageResponse(WordCache* wordCache, const QString& imageId, const QSize& requestedSize)
+    AsyncWordImageResponse::AsyncWordImageResponse(WordCache* wordCache, WordStorage* wordStorage, WordImageCache* imageCache,
+                                                   const QString& imageId, const QSize& requestedSize)
         : mWordCache(wordCache)
+        , mWordStorage(wordStorage)
+        , mImageCache(imageCache)
+        , mName(imageId)
         , mRequestedSize(requestedSize) {
         if (imageId == NO_IMAGE_ID) {
             qWarning() << TAG << "Word hasn't image!" << Qt::endl;
             return;
         }
 
+        if (std::optional<QImage> cachedImage = mImageCache->find(imageId, requestedSize)) {
+            qDebug() << TAG << "Load image from decoded cache!" << Qt::endl;
+
+            mImage = *cachedImage;
+
+            /*
+             * The engine connects to finished only after the response is returned.
+             */
+            QMetaObject::invokeMethod(this, &AsyncWordImageResponse::finished, Qt::QueuedConnection);
+            return;
+        }
+
         searchWordImage(imageId);
 
         QObject::connect(&mWordImageService, &WordImageService::wordImageProcessed,
@@ -59,10 +75,28 @@ namespace grunwald {
     }
 
     void AsyncWordImageResponse::searchWordImage(const QString& name) {
-        if (mWordCache->isValid()) {
-            WordImage wordImage = mWordCache->loadWordImage();
+        const std::shared_ptr<const Word> currentWord = mWordCache->loadSnapshot();
+        const std::optional<Word> cachedWord = currentWord != nullptr && currentWord->name == name
+                                             ? std::optional<Word>(*currentWord) : mWordCache->find(name);
+
+        if (cachedWord && (!cachedWord->image.data.isEmpty() || cachedWord->image.id > 0)) {
+            const WordImage& wordImage = cachedWord->image;
+
+            if (wordImage.data.isEmpty()) {
+                mWordStorage->loadWordImage(wordImage.id, prepareImageSize(wordImage)).then(this, [this](const Result<QImage, DbError>& result) {
+                    if (result.hasError()) {
+                        onResponseError(result.error().getMessage());
+                        return;
+                    }
+
+                    qInfo() << TAG << "Search word image from db success!" << Qt::endl;
+
+                    finishImage(result.value());
+                });
+                return;
+            }
 
-            qInfo() << TAG << "Search word image from db success!" << Qt::endl;
+            qInfo() << TAG << "Search word image from cache success!" << Qt::endl;
             onResponseFinished(wordImage);
 
         } else {
@@ -73,24 +107,31 @@ namespace grunwald {
     void AsyncWordImageResponse::onResponseCacheFinished(const WordImage& wordImage) {
         qInfo() << TAG << "Search word image from network success!" << Qt::endl;
 
-        mWordCache->storeWordImage(wordImage);
+        mWordCache->storeWordImage(mName, wordImage);
 
         onResponseFinished(wordImage);
     }
 
-    void AsyncWordImageResponse::onResponseFinished(const WordImage& wordImage) {
-        mImage = QImage::fromData(wordImage.data);
-
+    auto AsyncWordImageResponse::prepareImageSize(const WordImage& wordImage) const -> QSize {
         if (mRequestedSize.isValid()) {
-            mImage = mImage.scaled(qMin(mRequestedSize.width(), wordImage.width),
-                                   qMin(mRequestedSize.height(), wordImage.height));
-        } else {
-            mImage = mImage.scaled(DEFAULT_IMAGE_WIDTH, DEFAULT_IMAGE_HEIGHT);
+            return QSize(qMin(mRequestedSize.width(), wordImage.width),
+                         qMin(mRequestedSize.height(), wordImage.height));
         }
 
+        return QSize(DEFAULT_IMAGE_WIDTH, DEFAULT_IMAGE_HEIGHT);
+    }
+
+    void AsyncWordImageResponse::onResponseFinished(const WordImage& wordImage) {
+        finishImage(QImage::fromData(wordImage.data).scaled(prepareImageSize(wordImage)));
+
         qDebug() << TAG << "Load image success!" << Qt::endl;
+    }
+
+    void AsyncWordImageResponse::finishImage(const QImage& image) {
+        mImageCache->insert(mName, mRequestedSize, image);
+        mImage = image;
 
-        emit finished();
+        QMetaObject::invokeMethod(this, &AsyncWordImageResponse::finished, Qt::QueuedConnection);
     }
 
     void AsyncWordImageResponse::onResponseError(const QString& error) {
@@ -99,6 +140,6 @@ namespace grunwald {
 
         qWarning() << TAG << "Load image failed!" << Qt::endl;
 
-        emit finished();
+        QMetaObject::invokeMethod(this, &AsyncWordImageResponse::finished, Qt::QueuedConnection);
     }
 }
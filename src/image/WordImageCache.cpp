@@ -0,0 +1,90 @@
+/*
+ * Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+ * SPDX-License-Identifier: MIT
+ * Copyright (c) 2023-2025 https://github.com/klappdev
+ *
+ * Permission is hereby  granted, free of charge, to any  person obtaining a copy
+ * of this software and associated  documentation files (the "Software"), to deal
+ * in the Software  without restriction, including without  limitation the rights
+ * to  use, copy,  modify, merge,  publish, distribute,  sublicense, and/or  sell
+ * copies  of  the Software,  and  to  permit persons  to  whom  the Software  is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE  IS PROVIDED "AS  IS", WITHOUT WARRANTY  OF ANY KIND,  EXPRESS OR
+ * IMPLIED,  INCLUDING BUT  NOT  LIMITED TO  THE  WARRANTIES OF  MERCHANTABILITY,
+ * FITNESS FOR  A PARTICULAR PURPOSE AND  NONINFRINGEMENT. IN NO EVENT  SHALL THE
+ * AUTHORS  OR COPYRIGHT  HOLDERS  BE  LIABLE FOR  ANY  CLAIM,  DAMAGES OR  OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF  CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE  OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "image/WordImageCache.hpp"
+
+#include <memory>
+
+namespace grunwald {
+
+    WordImageCache::WordImageCache(qint64 byteBudget)
+        : mImages(byteBudget) {
+    }
+
+    auto WordImageCache::find(const QString& name, const QSize& requestedSize) -> std::optional<QImage> {
+        QMutexLocker locker(&mMutex);
+
+        const SizedImages* images = mImages.object(name);
+
+        if (images == nullptr) {
+            return std::nullopt;
+        }
+
+        const auto it = images->constFind(prepareKey(requestedSize));
+
+        if (it == images->cend()) {
+            return std::nullopt;
+        }
+
+        return it.value();
+    }
+
+    void WordImageCache::insert(const QString& name, const QSize& requestedSize, const QImage& image) {
+        if (image.isNull()) {
+            return;
+        }
+
+        QMutexLocker locker(&mMutex);
+
+        /*
+         * The entry is taken out and inserted again, so its cost covers every size.
+         */
+        std::unique_ptr<SizedImages> images(mImages.take(name));
+
+        if (images == nullptr) {
+            images = std::make_unique<SizedImages>();
+        }
+
+        images->insert(prepareKey(requestedSize), image);
+
+        qint64 cost = 0;
+
+        for (const QImage& sizedImage : std::as_const(*images)) {
+            cost += sizedImage.sizeInBytes();
+        }
+
+        mImages.insert(name, images.release(), cost);
+    }
+
+    void WordImageCache::remove(const QString& name) {
+        QMutexLocker locker(&mMutex);
+
+        mImages.remove(name);
+    }
+
+    auto WordImageCache::prepareKey(const QSize& requestedSize) -> quint64 {
+        return static_cast<quint64>(static_cast<quint32>(requestedSize.width())) << 32 |
+               static_cast<quint32>(requestedSize.height());
+    }
+}
@@ -0,0 +1,172 @@
+/*
+ * Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+ * SPDX-License-Identifier: MIT
+ * Copyright (c) 2023-2025 https://github.com/klappdev
+ *
+ * Permission is hereby  granted, free of charge, to any  person obtaining a copy
+ * of this software and associated  documentation files (the "Software"), to deal
+ * in the Software  without restriction, including without  limitation the rights
+ * to  use, copy,  modify, merge,  publish, distribute,  sublicense, and/or  sell
+ * copies  of  the Software,  and  to  permit persons  to  whom  the Software  is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE  IS PROVIDED "AS  IS", WITHOUT WARRANTY  OF ANY KIND,  EXPRESS OR
+ * IMPLIED,  INCLUDING BUT  NOT  LIMITED TO  THE  WARRANTIES OF  MERCHANTABILITY,
+ * FITNESS FOR  A PARTICULAR PURPOSE AND  NONINFRINGEMENT. IN NO EVENT  SHALL THE
+ * AUTHORS  OR COPYRIGHT  HOLDERS  BE  LIABLE FOR  ANY  CLAIM,  DAMAGES OR  OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF  CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE  OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "import/WiktextractParser.hpp"
+
+#include <QHash>
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QJsonParseError>
+
+using namespace Qt::Literals::StringLiterals;
+
+namespace {
+    constexpr const char* const DEFAULT_LANGUAGE = "German";  //FIXME: same language as WordParser
+
+    auto joinWords(const QJsonArray& values) -> QStringList {
+        QStringList words;
+
+        for (const QJsonValue& value : values) {
+            const QString word = value.toObject()["word"].toString();
+
+            if (!word.isEmpty()) {
+                words.push_back(word.toHtmlEscaped());
+            }
+        }
+
+        return words;
+    }
+}
+
+namespace grunwald {
+
+    auto WiktextractParser::parseEntry(const QByteArray& line) const -> Result<std::optional<Word>, ParserError> {
+        QJsonParseError jsonParserError;
+
+        const QJsonDocument jsonDocument = QJsonDocument::fromJson(line, &jsonParserError);
+
+        if (jsonParserError.error != QJsonParseError::NoError) {
+            return ParserError { "Json parse error: " + jsonParserError.errorString() };
+        }
+
+        if (!jsonDocument.isObject()) {
+            return ParserError { "Json document is not object" };
+        }
+
+        const QJsonObject entry = jsonDocument.object();
+
+        if (entry["lang"].toString() != DEFAULT_LANGUAGE) {
+            return std::optional<Word>{};
+        }
+
+        const QString name = entry["word"].toString();
+
+        if (name.isEmpty()) {
+            return ParserError { "Parse entry is not correct, 'word' doesn't exists" };
+        }
+
+        const QString etymologyText = entry["etymology_text"].toString();
+        const WordType wordType = parseType(entry);
+
+        return std::optional<Word> { Word {
+            .id = 0,
+            .name = name,
+            .transcription = parseTranscription(entry),
+            .translation = parseTranslation(entry),
+            .association = parseAssociation(entry),
+            .etymology = etymologyText.isEmpty() ? u""_s : "<p>" + etymologyText.toHtmlEscaped() + "</p>",
+            .description = wordType != WordType::Unknown ? parseDescription(entry) : u""_s,
+            .type = wordType,
+            .image = WordImage{},
+            .date = QDateTime::currentDateTime(),
+        } };
+    }
+
+    auto WiktextractParser::parseTranscription(const QJsonObject& entry) const -> QString {
+        //Same as Wiktionary: first pronunciation item
+        for (const QJsonValue& sound : entry["sounds"].toArray()) {
+            const QString ipa = sound.toObject()["ipa"].toString();
+
+            if (!ipa.isEmpty()) {
+                return "<li>IPA: <span class=\"IPA\">" + ipa.toHtmlEscaped() + "</span></li>";
+            }
+        }
+
+        return u""_s;
+    }
+
+    auto WiktextractParser::parseTranslation(const QJsonObject& entry) const -> QString {
+        //Same as Wiktionary: first sense item
+        for (const QJsonValue& sense : entry["senses"].toArray()) {
+            QStringList glosses;
+
+            for (const QJsonValue& gloss : sense.toObject()["glosses"].toArray()) {
+                glosses.push_back(gloss.toString().toHtmlEscaped());
+            }
+
+            if (!glosses.isEmpty()) {
+                return "<li>" + glosses.join(": ") + "</li>";
+            }
+        }
+
+        return u""_s;
+    }
+
+    auto WiktextractParser::parseType(const QJsonObject& entry) const -> WordType {
+        static const QHash<QString, WordType> wordTypes {
+            { u"noun"_s, WordType::Noun },
+            { u"name"_s, WordType::Noun },
+            { u"pron"_s, WordType::Pronoun },
+            { u"adj"_s, WordType::Adjective },
+            { u"verb"_s, WordType::Verb },
+            { u"adv"_s, WordType::Adverb },
+            { u"prep"_s, WordType::Preposition },
+            { u"conj"_s, WordType::Conjunction },
+            { u"intj"_s, WordType::Interjection },
+        };
+
+        return wordTypes.value(entry["pos"].toString(), WordType::Unknown);
+    }
+
+    auto WiktextractParser::parseDescription(const QJsonObject& entry) const -> QString {
+        //Same as Wiktionary: headword line under the part of speech
+        for (const QJsonValue& headTemplate : entry["head_templates"].toArray()) {
+            const QString expansion = headTemplate.toObject()["expansion"].toString();
+
+            if (!expansion.isEmpty()) {
+                return "<p>" + expansion.toHtmlEscaped() + "</p>";
+            }
+        }
+
+        return u""_s;
+    }
+
+    auto WiktextractParser::parseAssociation(const QJsonObject& entry) const -> QString {
+        QString result;
+
+        const QStringList antonyms = joinWords(entry["antonyms"].toArray());
+
+        if (!antonyms.isEmpty()) {
+            result += "<p>" + antonyms.join(", ") + "</p>";
+        }
+
+        const QStringList synonyms = joinWords(entry["synonyms"].toArray());
+
+        if (!synonyms.isEmpty()) {
+            result += "<ul><li>" + synonyms.join("</li><li>") + "</li></ul>";
+        }
+
+        return result;
+    }
+}
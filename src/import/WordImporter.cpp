@@ -0,0 +1,241 @@
+/*
+ * Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+ * SPDX-License-Identifier: MIT
+ * Copyright (c) 2023-2025 https://github.com/klappdev
+ *
+ * Permission is hereby  granted, free of charge, to any  person obtaining a copy
+ * of this software and associated  documentation files (the "Software"), to deal
+ * in the Software  without restriction, including without  limitation the rights
+ * to  use, copy,  modify, merge,  publish, distribute,  sublicense, and/or  sell
+ * copies  of  the Software,  and  to  permit persons  to  whom  the Software  is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE  IS PROVIDED "AS  IS", WITHOUT WARRANTY  OF ANY KIND,  EXPRESS OR
+ * IMPLIED,  INCLUDING BUT  NOT  LIMITED TO  THE  WARRANTIES OF  MERCHANTABILITY,
+ * FITNESS FOR  A PARTICULAR PURPOSE AND  NONINFRINGEMENT. IN NO EVENT  SHALL THE
+ * AUTHORS  OR COPYRIGHT  HOLDERS  BE  LIABLE FOR  ANY  CLAIM,  DAMAGES OR  OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF  CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE  OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "import/WordImporter.hpp"
+
+#include <QElapsedTimer>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QSaveFile>
+#include <QSet>
+#include <QtConcurrent>
+
+#include <algorithm>
+
+namespace {
+    constexpr const char* const TAG = "[WordImporter] ";
+
+    /*
+     * Chunk limits, one chunk is written in one transaction.
+     * Two chunks are in memory at most: one parsed, one being written.
+     */
+    constexpr qsizetype CHUNK_LINES = 4096;
+    constexpr qint64 CHUNK_BYTES = 16 * 1024 * 1024;
+
+    constexpr qint64 PROGRESS_INTERVAL_MS = 5000;
+
+    auto checkpointFileName(const QString& dumpFileName) -> QString {
+        return dumpFileName + ".checkpoint";
+    }
+}
+
+namespace grunwald {
+
+    WordImporter::WordImporter(WordDao& wordDao)
+        : mWordDao(wordDao) {
+    }
+
+    auto WordImporter::run(const QString& dumpFileName) -> Result<Stats, ImportError> {
+        QFile dumpFile(dumpFileName);
+
+        if (!dumpFile.open(QIODevice::ReadOnly)) {
+            return ImportError { dumpFile.errorString() };
+        }
+
+        Stats stats {};
+        const qint64 dumpSize = dumpFile.size();
+        const qint64 offset = loadCheckpoint(dumpFileName, dumpSize, stats);
+
+        if (offset > 0) {
+            qInfo() << TAG << "Resume import of " << dumpFileName << " from offset " << offset << Qt::endl;
+            dumpFile.seek(offset);
+        }
+
+        const qint64 resumedElapsedMs = stats.elapsedMs;
+
+        QElapsedTimer timer;
+        timer.start();
+        qint64 lastProgressMs = 0;
+
+        Chunk chunk = readChunk(dumpFile);
+        QFuture<ParsedEntry> parsing = parseChunk(chunk);
+
+        while (!chunk.lines.isEmpty()) {
+            const QList<ParsedEntry> entries = parsing.results();
+            const qint64 endOffset = chunk.endOffset;
+
+            /*
+             * Next chunk is parsed on the pool while this one is written.
+             */
+            chunk = readChunk(dumpFile);
+            parsing = parseChunk(chunk);
+
+            if (auto written = writeChunk(entries, stats); written.hasError()) {
+                parsing.waitForFinished();
+                return written.error();
+            }
+
+            stats.elapsedMs = resumedElapsedMs + timer.elapsed();
+            saveCheckpoint(dumpFileName, dumpSize, endOffset, stats);
+
+            if (stats.elapsedMs - lastProgressMs >= PROGRESS_INTERVAL_MS) {
+                lastProgressMs = stats.elapsedMs;
+
+                qInfo() << TAG << "Progress: " << endOffset * 100 / std::max<qint64>(dumpSize, 1) << "%, entries: " << stats.entries
+                        << ", imported: " << stats.imported << ", " << qRound(stats.entriesPerSecond()) << " entries/s" << Qt::endl;
+            }
+        }
+
+        stats.elapsedMs = resumedElapsedMs + timer.elapsed();
+        QFile::remove(checkpointFileName(dumpFileName));
+
+        return stats;
+    }
+
+    auto WordImporter::readChunk(QFile& dumpFile) -> Chunk {
+        Chunk chunk {};
+        qint64 chunkBytes = 0;
+
+        while (chunk.lines.size() < CHUNK_LINES && chunkBytes < CHUNK_BYTES && !dumpFile.atEnd()) {
+            QByteArray line = dumpFile.readLine();
+
+            if (line.trimmed().isEmpty()) {
+                continue;
+            }
+
+            chunkBytes += line.size();
+            chunk.lines.push_back(std::move(line));
+        }
+
+        chunk.endOffset = dumpFile.pos();
+
+        return chunk;
+    }
+
+    auto WordImporter::parseChunk(const Chunk& chunk) -> QFuture<ParsedEntry> {
+        return QtConcurrent::mapped(chunk.lines, [this](const QByteArray& line) {
+            return mParser.parseEntry(line);
+        });
+    }
+
+    auto WordImporter::writeChunk(const QList<ParsedEntry>& entries, Stats& stats) -> Result<void, ImportError> {
+        QVector<Word> words;
+        words.reserve(entries.size());
+
+        QSet<QString> names;
+        names.reserve(entries.size());
+
+        for (const ParsedEntry& entry : entries) {
+            ++stats.entries;
+
+            if (entry.hasError()) {
+                ++stats.failed;
+                qWarning() << TAG << "Parse entry failed: " << entry.error().getMessage() << Qt::endl;
+                continue;
+            }
+
+            if (!entry.value()) {
+                ++stats.skipped;
+                continue;
+            }
+
+            const Word& word = *entry.value();
+
+            /*
+             * Every part of speech is a separate entry, not always adjacent in the dump:
+             * the first one of a headword in the chunk is kept. Earlier chunks are saved
+             * already and saved words are never overwritten, so a replayed chunk is a no-op.
+             */
+            if (names.contains(word.name) || mWordDao.checkIfExists(word.name)) {
+                ++stats.skipped;
+            } else {
+                names.insert(word.name);
+                words.push_back(word);
+            }
+        }
+
+        if (words.isEmpty()) {
+            return {};
+        }
+
+        const QVector<Result<void, DbError>> results = mWordDao.addBatch(words);
+        const qint64 failed = std::count_if(results.cbegin(), results.cend(), [](const Result<void, DbError>& result) {
+            return result.hasError();
+        });
+
+        if (failed == results.size()) {
+            return ImportError { "Write chunk failed: " + results.front().error().getMessage() };
+        }
+
+        stats.imported += results.size() - failed;
+        stats.failed += failed;
+
+        return {};
+    }
+
+    auto WordImporter::loadCheckpoint(const QString& dumpFileName, qint64 dumpSize, Stats& stats) -> qint64 {
+        QFile checkpointFile(checkpointFileName(dumpFileName));
+
+        if (!checkpointFile.open(QIODevice::ReadOnly)) {
+            return 0;
+        }
+
+        const QJsonObject checkpoint = QJsonDocument::fromJson(checkpointFile.readAll()).object();
+
+        if (checkpoint["dumpSize"].toInteger(-1) != dumpSize) {
+            qWarning() << TAG << "Checkpoint belongs to another dump, import starts from the beginning" << Qt::endl;
+            return 0;
+        }
+
+        stats = Stats {
+            .entries = checkpoint["entries"].toInteger(),
+            .imported = checkpoint["imported"].toInteger(),
+            .skipped = checkpoint["skipped"].toInteger(),
+            .failed = checkpoint["failed"].toInteger(),
+            .elapsedMs = checkpoint["elapsedMs"].toInteger(),
+        };
+
+        return std::clamp<qint64>(checkpoint["offset"].toInteger(), 0, dumpSize);
+    }
+
+    void WordImporter::saveCheckpoint(const QString& dumpFileName, qint64 dumpSize, qint64 offset, const Stats& stats) {
+        const QJsonObject checkpoint {
+            { "dumpSize", dumpSize },
+            { "offset", offset },
+            { "entries", stats.entries },
+            { "imported", stats.imported },
+            { "skipped", stats.skipped },
+            { "failed", stats.failed },
+            { "elapsedMs", stats.elapsedMs },
+        };
+
+        QSaveFile checkpointFile(checkpointFileName(dumpFileName));
+
+        if (!checkpointFile.open(QIODevice::WriteOnly) ||
+            checkpointFile.write(QJsonDocument(checkpoint).toJson(QJsonDocument::Compact)) < 0 ||
+            !checkpointFile.commit()) {
+            qWarning() << TAG << "Save checkpoint failed: " << checkpointFile.errorString() << Qt::endl;
+        }
+    }
+}
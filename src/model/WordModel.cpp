@@ -44,7 +44,12 @@ namespace grunwald {
         .date = QDateTime::currentDateTime()
     };
 
-    WordModel::WordModel(QObject* parent) : QAbstractListModel(parent) {
+    WordModel::WordModel(QObject* parent)
+        : QAbstractListModel(parent)
+        , mStorage(nullptr)
+        , mHasMoreWords(false)
+        , mFetchingWords(false)
+        , mGeneration(0) {
         if (mWords.isEmpty()) {
             mWords.append(EMPTY_WORD);
         }
@@ -114,19 +119,79 @@ namespace grunwald {
         return roles;
     }
 
+    bool WordModel::canFetchMore(const QModelIndex& parent) const {
+        return !parent.isValid() && mStorage != nullptr && mHasMoreWords && !mFetchingWords;
+    }
+
+    void WordModel::fetchMore(const QModelIndex& parent) {
+        if (!canFetchMore(parent) || mWords.isEmpty()) {
+            return;
+        }
+
+        mFetchingWords = true;
+
+        const Word& lastWord = mWords.constLast();
+        const quint64 generation = mGeneration;
+
+        mStorage->loadWordsPage(lastWord.name, lastWord.id).then(this, [this, generation](const Result<QVector<Word>, DbError>& result) {
+            mFetchingWords = false;
+
+            if (generation != mGeneration) {
+                return;
+            }
+
+            if (result.hasError()) {
+                qWarning() << TAG << "Fetch more words failed: " << result.error().getMessage();
+
+                mHasMoreWords = false;
+                return;
+            }
+
+            const QVector<Word>& words = result.value();
+            mHasMoreWords = words.size() >= WordStorage::WORDS_PAGE_SIZE;
+
+            if (words.isEmpty()) {
+                return;
+            }
+
+            emit beginInsertRows(QModelIndex(), mWords.size(), mWords.size() + words.size() - 1);
+            mWords.append(words);
+            emit endInsertRows();
+
+            qDebug() << TAG << "Fetch more words" << rowCount() << " success!";
+        });
+    }
+
+    WordStorage* WordModel::storage() const {
+        return mStorage;
+    }
+
+    void WordModel::setStorage(WordStorage* storage) {
+        if (mStorage == storage) {
+            return;
+        }
+
+        mStorage = storage;
+        emit storageChanged();
+    }
+
     void WordModel::storeWord(const Word& word) {
         emit beginResetModel();
         mWords.clear();
         mWords.insert(0, word);
+        mHasMoreWords = false;
+        ++mGeneration;
         emit endResetModel();
 
         qDebug() << TAG << "Update word model" << rowCount() << " success!";
     }
 
-    void WordModel::storeWords(const QList<Word>& list) {
+    void WordModel::storeWords(const QList<Word>& list, bool hasMore) {
         emit beginResetModel();
         mWords.clear();
         mWords.append(list);
+        mHasMoreWords = hasMore;
+        ++mGeneration;
         emit endResetModel();
 
         qDebug() << TAG << "Update word model" << rowCount() << " success!";
@@ -23,6 +23,7 @@
  */
 
 #include "net/WordContentService.hpp"
+#include "net/WordNetworkCache.hpp"
 
 #include <QNetworkReply>
 #include <QNetworkRequest>
@@ -31,29 +32,36 @@
 namespace {
     constexpr const char* const TAG = "[WordContentService] ";
     const QString BASE_API_URL = "https://en.wiktionary.org";
-    const QString WORD_CONTENT_API_TEMPLATE = "/w/api.php?format=json&action=%1&prop=%2&redirects&continue&titles=%3";
+    const QString WORD_CONTENT_API_TEMPLATE = "/w/api.php?format=json&action=%1&prop=%2&maxage=86400&redirects&continue&titles=%3";
     const QString REMOTE_SERVER_UNAVAILABLE = "Remote %1 server is not available";
 }
 
 namespace grunwald {
 
     WordContentService::WordContentService(QObject* parent) : QObject(parent) {
+        mNetworkManager.setCache(new WordNetworkCache(&mNetworkManager));
     }
 
     WordContentService::~WordContentService() {
     }
 
     void WordContentService::fetchWordContent(const QString& name) {
-        mWordName = name;
-
         if (!checkInternetConnection()) {
             const NetworkError networkError { REMOTE_SERVER_UNAVAILABLE.arg(BASE_API_URL) };
             qWarning() << TAG << networkError << Qt::endl;
 
-            emit wordContentErrorProcessed(networkError.getMessage());
+            emit wordContentErrorProcessed(name, networkError.getMessage());
             return;
         }
 
+        sendRequest(name);
+    }
+
+    auto WordContentService::prefetchWordContent(const QString& name) -> QNetworkReply* {
+        return sendRequest(name);
+    }
+
+    auto WordContentService::sendRequest(const QString& name) -> QNetworkReply* {
         const QString prepareApiUrl = WORD_CONTENT_API_TEMPLATE.arg("query")
             .arg("extracts")
             .arg(name);
@@ -66,15 +74,19 @@ namespace grunwald {
 
         QNetworkReply* reply = mNetworkManager.get(request);
 
-        QObject::connect(reply, &QNetworkReply::finished,
-                         this, &WordContentService::onWordContentRequestFinished);
-    }
+        /*
+         * Requests may overlap, every reply carries the name it was sent for.
+         */
+        QObject::connect(reply, &QNetworkReply::finished, this, [this, reply, name]() {
+            onWordContentRequestFinished(reply, name);
+        });
 
-    void WordContentService::onWordContentRequestFinished() {
-        auto* reply = static_cast<QNetworkReply*>(sender());
+        return reply;
+    }
 
+    void WordContentService::onWordContentRequestFinished(QNetworkReply* reply, const QString& name) {
         const QByteArray remoteData = reply->readAll();
-        const Result<Word, ParserError> wordContentResult = mWordParser.parseWordContent(mWordName, remoteData);
+        const Result<Word, ParserError> wordContentResult = mWordParser.parseWordContent(name, remoteData);
         const QNetworkReply::NetworkError replyError = reply->error();
 
         if (replyError == QNetworkReply::NoError && wordContentResult.hasValue()) {
@@ -83,11 +95,20 @@ namespace grunwald {
             if (errorCode >= 200 && errorCode < 300) {
                 emit wordContentProcessed(wordContentResult.value());
             }
+        } else if (replyError == QNetworkReply::NoError) {
+            const ParserError& parserError = wordContentResult.error();
+            const auto reason = static_cast<ParserErrorCode>(parserError.getCode());
+
+            if (reason == ParserErrorCode::NotFound || reason == ParserErrorCode::LanguageNotFound) {
+                emit wordContentMissed(name, parserError.getCode(), parserError.getMessage());
+            } else {
+                emit wordContentErrorProcessed(name, parserError.getMessage());
+            }
         } else {
             if (replyError == QNetworkReply::ContentNotFoundError ||
                 replyError == QNetworkReply::ContentAccessDenied ||
                 replyError == QNetworkReply::ProtocolInvalidOperationError) {
-                emit wordContentErrorProcessed(reply->errorString() + ", " + wordContentResult.error().getMessage());
+                emit wordContentErrorProcessed(name, reply->errorString() + (wordContentResult.hasError() ? ", " + wordContentResult.error().getMessage() : QString{}));
             }
         }
 
@@ -99,6 +120,8 @@ namespace grunwald {
 #if QT_VERSION >= QT_VERSION_CHECK(5, 15, 0)
         QEventLoop eventLoop;
         QNetworkRequest request(QUrl("http://www.google.com"));
+        request.setAttribute(QNetworkRequest::CacheLoadControlAttribute, QNetworkRequest::AlwaysNetwork);
+        request.setAttribute(QNetworkRequest::CacheSaveControlAttribute, false);
 
         QNetworkReply* reply = mNetworkManager.get(request);
 
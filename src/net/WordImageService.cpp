@@ -23,6 +23,7 @@
  */
 
 #include "net/WordImageService.hpp"
+#include "net/WordNetworkCache.hpp"
 
 #include <QNetworkReply>
 #include <QNetworkRequest>
@@ -31,13 +32,14 @@
 namespace {
     constexpr const char* const TAG = "[WordImageService] ";
     const QString BASE_API_URL = "https://en.wiktionary.org";
-    const QString WORD_IMAGE_API_TEMPLATE = "/w/api.php?format=json&action=%1&prop=%2&piprop=%3&redirects&continue&titles=%4";
+    const QString WORD_IMAGE_API_TEMPLATE = "/w/api.php?format=json&action=%1&prop=%2&piprop=%3&maxage=86400&redirects&continue&titles=%4";
     const QString REMOTE_SERVER_UNAVAILABLE = "Remote %1 server is not available";
 }
 
 namespace grunwald {
 
     WordImageService::WordImageService(QObject* parent) : QObject(parent) {
+        mNetworkManager.setCache(new WordNetworkCache(&mNetworkManager));
     }
 
     WordImageService::~WordImageService() {
@@ -147,6 +149,8 @@ namespace grunwald {
 #if QT_VERSION >= QT_VERSION_CHECK(5, 15, 0)
         QEventLoop eventLoop;
         QNetworkRequest request(QUrl(QStringLiteral("http://www.google.com")));
+        request.setAttribute(QNetworkRequest::CacheLoadControlAttribute, QNetworkRequest::AlwaysNetwork);
+        request.setAttribute(QNetworkRequest::CacheSaveControlAttribute, false);
 
         QNetworkReply* reply = mNetworkManager.get(request);
 
@@ -0,0 +1,135 @@
+/*
+ * Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+ * SPDX-License-Identifier: MIT
+ * Copyright (c) 2023-2025 https://github.com/klappdev
+ *
+ * Permission is hereby  granted, free of charge, to any  person obtaining a copy
+ * of this software and associated  documentation files (the "Software"), to deal
+ * in the Software  without restriction, including without  limitation the rights
+ * to  use, copy,  modify, merge,  publish, distribute,  sublicense, and/or  sell
+ * copies  of  the Software,  and  to  permit persons  to  whom  the Software  is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE  IS PROVIDED "AS  IS", WITHOUT WARRANTY  OF ANY KIND,  EXPRESS OR
+ * IMPLIED,  INCLUDING BUT  NOT  LIMITED TO  THE  WARRANTIES OF  MERCHANTABILITY,
+ * FITNESS FOR  A PARTICULAR PURPOSE AND  NONINFRINGEMENT. IN NO EVENT  SHALL THE
+ * AUTHORS  OR COPYRIGHT  HOLDERS  BE  LIABLE FOR  ANY  CLAIM,  DAMAGES OR  OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF  CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE  OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "net/WordNetworkCache.hpp"
+
+#include <QDebug>
+#include <QDir>
+#include <QMutex>
+#include <QNetworkDiskCache>
+#include <QStandardPaths>
+
+namespace {
+    constexpr const char* const TAG = "[WordNetworkCache] ";
+    constexpr const char* const CACHE_DIRECTORY = "network";
+
+    struct SharedCache final {
+        SharedCache() {
+            const QString location = QStandardPaths::writableLocation(QStandardPaths::CacheLocation);
+
+            cache.setCacheDirectory(QDir(location).filePath(CACHE_DIRECTORY));
+            cache.setMaximumCacheSize(grunwald::WordNetworkCache::MAX_CACHE_SIZE);
+        }
+
+        QMutex mutex;
+        QNetworkDiskCache cache;
+        grunwald::WordNetworkCache::Stats stats {};
+    };
+
+    Q_GLOBAL_STATIC(SharedCache, sharedCache)
+}
+
+namespace grunwald {
+
+    WordNetworkCache::WordNetworkCache(QObject* parent) : QAbstractNetworkCache(parent) {
+    }
+
+    WordNetworkCache::~WordNetworkCache() {
+    }
+
+    auto WordNetworkCache::stats() -> Stats {
+        QMutexLocker locker(&sharedCache->mutex);
+
+        return sharedCache->stats;
+    }
+
+    QNetworkCacheMetaData WordNetworkCache::metaData(const QUrl& url) {
+        QMutexLocker locker(&sharedCache->mutex);
+
+        /*
+         * The manager probes metadata several times per request, hits and misses
+         * are counted where a response is actually loaded or downloaded.
+         */
+        return sharedCache->cache.metaData(url);
+    }
+
+    void WordNetworkCache::updateMetaData(const QNetworkCacheMetaData& metaData) {
+        QMutexLocker locker(&sharedCache->mutex);
+
+        /*
+         * The manager only refreshes metadata of an entry after a 304 answer.
+         */
+        ++sharedCache->stats.revalidated;
+        sharedCache->cache.updateMetaData(metaData);
+    }
+
+    QIODevice* WordNetworkCache::data(const QUrl& url) {
+        QMutexLocker locker(&sharedCache->mutex);
+
+        QIODevice* device = sharedCache->cache.data(url);
+
+        if (device != nullptr) {
+            ++sharedCache->stats.hits;
+            qDebug() << TAG << "Response from cache: " << url.toString() << Qt::endl;
+        }
+
+        return device;
+    }
+
+    bool WordNetworkCache::remove(const QUrl& url) {
+        QMutexLocker locker(&sharedCache->mutex);
+
+        return sharedCache->cache.remove(url);
+    }
+
+    qint64 WordNetworkCache::cacheSize() const {
+        QMutexLocker locker(&sharedCache->mutex);
+
+        return sharedCache->cache.cacheSize();
+    }
+
+    QIODevice* WordNetworkCache::prepare(const QNetworkCacheMetaData& metaData) {
+        QMutexLocker locker(&sharedCache->mutex);
+
+        /*
+         * Called once per downloaded cacheable response, a 304 answer updates metadata instead.
+         */
+        ++sharedCache->stats.misses;
+
+        return sharedCache->cache.prepare(metaData);
+    }
+
+    void WordNetworkCache::insert(QIODevice* device) {
+        QMutexLocker locker(&sharedCache->mutex);
+
+        ++sharedCache->stats.stored;
+        sharedCache->cache.insert(device);
+    }
+
+    void WordNetworkCache::clear() {
+        QMutexLocker locker(&sharedCache->mutex);
+
+        sharedCache->cache.clear();
+    }
+}
@@ -103,7 +103,8 @@ namespace grunwald {
         const QJsonObject pagesObject = pagesValue.toObject();
 
         if (pagesObject.isEmpty()) {
-            const ParserError error { "Parse json data is not correct, first 'page' doesn't exists" };
+            const ParserError error { "Parse json data is not correct, first 'page' doesn't exists",
+                                      static_cast<qint32>(ParserErrorCode::NotFound) };
             qWarning() << TAG << error << Qt::endl;
 
             return error;
@@ -113,7 +114,8 @@ namespace grunwald {
         const QJsonValue extractValue = firstPageObject["extract"];
 
         if (!extractValue.isString()) {
-            const ParserError error { "Parse json data is not correct, 'extract' doesn't exists" };
+            const ParserError error { "Parse json data is not correct, 'extract' doesn't exists",
+                                      static_cast<qint32>(ParserErrorCode::NotFound) };
             qWarning() << TAG << error << Qt::endl;
 
             return error;
@@ -235,7 +237,8 @@ namespace grunwald {
             return languageText.error();
         } else if (languageText.value() != DEFAULT_LANGUAGE) {
             const auto detectLanguage = languageText.value();
-            return ParserError{ QString("Detect language %1 is not found. Found language %2").arg(DEFAULT_LANGUAGE).arg(detectLanguage) };
+            return ParserError{ QString("Detect language %1 is not found. Found language %2").arg(DEFAULT_LANGUAGE).arg(detectLanguage),
+                                static_cast<qint32>(ParserErrorCode::LanguageNotFound) };
         }
 
         const auto etymologyText = parseEtymologyWord(rootNode);
@@ -256,7 +259,7 @@ namespace grunwald {
 
         qDebug() << TAG << "End parse word" << Qt::endl;
 
-        return Word{ 1, name, transcriptionText, translationText, associationText,
+        return Word{ 0, name, transcriptionText, translationText, associationText,
                     etymologyText, descriptionText, wordType, WordImage{},
                     QDateTime::currentDateTime() };
     }
@@ -273,7 +276,8 @@ namespace grunwald {
             return h2Node.innerText();
         }
 
-        return ParserError{ QString("Parse language %1 is not found").arg(DEFAULT_LANGUAGE) };
+        return ParserError{ QString("Parse language %1 is not found").arg(DEFAULT_LANGUAGE),
+                            static_cast<qint32>(ParserErrorCode::LanguageNotFound) };
     }
 
     auto WordParser::parseEtymologyWord(const QGumboNode& node) -> QString {
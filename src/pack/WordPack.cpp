@@ -0,0 +1,182 @@
+/*
+ * Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+ * SPDX-License-Identifier: MIT
+ * Copyright (c) 2023-2025 https://github.com/klappdev
+ *
+ * Permission is hereby  granted, free of charge, to any  person obtaining a copy
+ * of this software and associated  documentation files (the "Software"), to deal
+ * in the Software  without restriction, including without  limitation the rights
+ * to  use, copy,  modify, merge,  publish, distribute,  sublicense, and/or  sell
+ * copies  of  the Software,  and  to  permit persons  to  whom  the Software  is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE  IS PROVIDED "AS  IS", WITHOUT WARRANTY  OF ANY KIND,  EXPRESS OR
+ * IMPLIED,  INCLUDING BUT  NOT  LIMITED TO  THE  WARRANTIES OF  MERCHANTABILITY,
+ * FITNESS FOR  A PARTICULAR PURPOSE AND  NONINFRINGEMENT. IN NO EVENT  SHALL THE
+ * AUTHORS  OR COPYRIGHT  HOLDERS  BE  LIABLE FOR  ANY  CLAIM,  DAMAGES OR  OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF  CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE  OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "pack/WordPack.hpp"
+#include "util/WordNormalizer.hpp"
+
+#include <algorithm>
+
+namespace {
+    constexpr const char* const TAG = "[WordPack] ";
+
+    auto isTableValid(quint64 offset, quint64 entrySize, quint64 count, qint64 fileSize, quint64 alignment) -> bool {
+        return offset % alignment == 0 && offset <= static_cast<quint64>(fileSize) &&
+               count <= (static_cast<quint64>(fileSize) - offset) / entrySize;
+    }
+}
+
+namespace grunwald {
+
+    WordPack::~WordPack() {
+        close();
+    }
+
+    auto WordPack::open(const QString& fileName) -> Result<void, PackError> {
+        using namespace WordPackFormat;
+
+        close();
+
+        mFile.setFileName(fileName);
+
+        if (!mFile.open(QIODevice::ReadOnly)) {
+            return PackError { mFile.errorString() };
+        }
+
+        mSize = mFile.size();
+        mData = mSize >= static_cast<qint64>(sizeof(Header)) ? mFile.map(0, mSize) : nullptr;
+
+        if (mData == nullptr) {
+            close();
+            return PackError { "Dictionary pack can't be mapped: " + fileName };
+        }
+
+        mHeader = reinterpret_cast<const Header*>(mData);
+
+        if (mHeader->magic != MAGIC || mHeader->version != VERSION ||
+            !isTableValid(mHeader->keyTableOffset, sizeof(KeyEntry), mHeader->wordCount, mSize, alignof(KeyEntry)) ||
+            !isTableValid(mHeader->recordTableOffset, sizeof(Record), mHeader->wordCount, mSize, alignof(Record)) ||
+            !isTableValid(mHeader->heapOffset, 1, mHeader->heapSize, mSize, alignof(char16_t))) {
+            close();
+            return PackError { "Dictionary pack has unknown format: " + fileName };
+        }
+
+        mKeys = reinterpret_cast<const KeyEntry*>(mData + mHeader->keyTableOffset);
+        mRecords = reinterpret_cast<const Record*>(mData + mHeader->recordTableOffset);
+        mHeap = mData + mHeader->heapOffset;
+
+        qInfo() << TAG << "Dictionary pack " << fileName << " opened, words: " << mHeader->wordCount << Qt::endl;
+
+        return {};
+    }
+
+    void WordPack::close() {
+        if (mData != nullptr) {
+            mFile.unmap(const_cast<uchar*>(mData));
+        }
+
+        mFile.close();
+
+        mData = nullptr;
+        mSize = 0;
+        mHeader = nullptr;
+        mKeys = nullptr;
+        mRecords = nullptr;
+        mHeap = nullptr;
+    }
+
+    bool WordPack::isOpen() const {
+        return mHeader != nullptr;
+    }
+
+    auto WordPack::size() const -> qsizetype {
+        return isOpen() ? static_cast<qsizetype>(mHeader->wordCount) : 0;
+    }
+
+    auto WordPack::find(const QString& name) const -> std::optional<Word> {
+        if (!isOpen()) {
+            return std::nullopt;
+        }
+
+        const QString key = WordNormalizer::toKey(name);
+        const WordPackFormat::KeyEntry* keysEnd = mKeys + mHeader->wordCount;
+
+        const WordPackFormat::KeyEntry* it = std::lower_bound(mKeys, keysEnd, QStringView(key),
+            [this](const WordPackFormat::KeyEntry& entry, QStringView value) {
+                return compareKey(entry, value) < 0;
+            });
+
+        if (it == keysEnd || compareKey(*it, key) != 0 || it->recordIndex >= mHeader->wordCount) {
+            return std::nullopt;
+        }
+
+        return prepareWord(mRecords[it->recordIndex]);
+    }
+
+    auto WordPack::heapString(const WordPackFormat::StringRef& ref) const -> QStringView {
+        const quint64 byteSize = static_cast<quint64>(ref.length) * sizeof(char16_t);
+
+        if (ref.offset % alignof(char16_t) != 0 || ref.offset > mHeader->heapSize || byteSize > mHeader->heapSize - ref.offset) {
+            qWarning() << TAG << "Dictionary pack string is out of bounds" << Qt::endl;
+            return {};
+        }
+
+        return QStringView(reinterpret_cast<const char16_t*>(mHeap + ref.offset), ref.length);
+    }
+
+    auto WordPack::compareKey(const WordPackFormat::KeyEntry& entry, QStringView key) const -> int {
+        /*
+         * Keys shorter than the prefix are padded with zeros, which sort first like a shorter string.
+         */
+        for (qsizetype i = 0; i < WordPackFormat::KEY_PREFIX_SIZE; ++i) {
+            const char16_t keyUnit = i < key.size() ? key.at(i).unicode() : u'\0';
+
+            if (entry.prefix[i] != keyUnit) {
+                return entry.prefix[i] < keyUnit ? -1 : 1;
+            }
+
+            if (keyUnit == u'\0') {
+                return 0;
+            }
+        }
+
+        return heapString(entry.key).compare(key);
+    }
+
+    auto WordPack::prepareWord(const WordPackFormat::Record& record) const -> Word {
+        using WordPackFormat::Field;
+
+        const auto field = [this, &record](Field type) {
+            return heapString(record.fields[static_cast<std::size_t>(type)]).toString();
+        };
+
+        return Word {
+            .id = 0,
+            .name = field(Field::Name),
+            .transcription = field(Field::Transcription),
+            .translation = field(Field::Translation),
+            .association = field(Field::Association),
+            .etymology = field(Field::Etymology),
+            .description = field(Field::Description),
+            .type = static_cast<WordType>(record.type),
+            .image = WordImage {
+                .id = 0,
+                .url = QUrl(field(Field::ImageUrl)),
+                .width = record.imageWidth,
+                .height = record.imageHeight,
+                .data = QByteArray{},
+            },
+            .date = record.date >= 0 ? QDateTime::fromMSecsSinceEpoch(record.date) : QDateTime{},
+        };
+    }
+}
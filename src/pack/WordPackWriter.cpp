@@ -0,0 +1,169 @@
+/*
+ * Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+ * SPDX-License-Identifier: MIT
+ * Copyright (c) 2023-2025 https://github.com/klappdev
+ *
+ * Permission is hereby  granted, free of charge, to any  person obtaining a copy
+ * of this software and associated  documentation files (the "Software"), to deal
+ * in the Software  without restriction, including without  limitation the rights
+ * to  use, copy,  modify, merge,  publish, distribute,  sublicense, and/or  sell
+ * copies  of  the Software,  and  to  permit persons  to  whom  the Software  is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE  IS PROVIDED "AS  IS", WITHOUT WARRANTY  OF ANY KIND,  EXPRESS OR
+ * IMPLIED,  INCLUDING BUT  NOT  LIMITED TO  THE  WARRANTIES OF  MERCHANTABILITY,
+ * FITNESS FOR  A PARTICULAR PURPOSE AND  NONINFRINGEMENT. IN NO EVENT  SHALL THE
+ * AUTHORS  OR COPYRIGHT  HOLDERS  BE  LIABLE FOR  ANY  CLAIM,  DAMAGES OR  OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF  CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE  OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "pack/WordPackWriter.hpp"
+#include "pack/WordPackFormat.hpp"
+#include "util/WordNormalizer.hpp"
+
+#include <QSaveFile>
+
+#include <algorithm>
+#include <limits>
+
+namespace {
+    constexpr const char* const TAG = "[WordPackWriter] ";
+
+    constexpr qsizetype SECTION_ALIGNMENT = 8;
+
+    auto alignedSize(qsizetype size) -> qsizetype {
+        return (size + SECTION_ALIGNMENT - 1) / SECTION_ALIGNMENT * SECTION_ALIGNMENT;
+    }
+
+    template<typename T>
+    void append(QByteArray& bytes, const T& value) {
+        bytes.append(reinterpret_cast<const char*>(&value), sizeof(T));
+    }
+}
+
+namespace grunwald {
+
+    auto WordPackWriter::write(const QString& fileName, const QVector<Word>& words) -> Result<qsizetype, PackError> {
+        using namespace WordPackFormat;
+
+        struct Entry final {
+            QString key;
+            const Word* word;
+        };
+
+        QVector<Entry> entries;
+        entries.reserve(words.size());
+
+        for (const Word& word : words) {
+            QString key = WordNormalizer::toKey(word.name);
+
+            if (!key.isEmpty()) {
+                entries.push_back(Entry { std::move(key), &word });
+            }
+        }
+
+        std::stable_sort(entries.begin(), entries.end(), [](const Entry& left, const Entry& right) {
+            return QStringView(left.key).compare(QStringView(right.key)) < 0;
+        });
+
+        entries.erase(std::unique(entries.begin(), entries.end(), [](const Entry& left, const Entry& right) {
+            return left.key == right.key;
+        }), entries.end());
+
+        if (entries.size() > std::numeric_limits<quint32>::max()) {
+            return PackError { "Too many words for a dictionary pack" };
+        }
+
+        QByteArray heap;
+
+        const auto addString = [&heap](QStringView value) {
+            const StringRef ref {
+                .offset = static_cast<quint32>(heap.size()),
+                .length = static_cast<quint32>(value.size()),
+            };
+            heap.append(reinterpret_cast<const char*>(value.utf16()), value.size() * sizeof(char16_t));
+            return ref;
+        };
+
+        QByteArray keyTable;
+        QByteArray recordTable;
+        keyTable.reserve(entries.size() * sizeof(KeyEntry));
+        recordTable.reserve(entries.size() * sizeof(Record));
+
+        for (qsizetype i = 0; i < entries.size(); ++i) {
+            const Entry& entry = entries.at(i);
+            const Word& word = *entry.word;
+
+            KeyEntry keyEntry {
+                .prefix = {},
+                .key = addString(entry.key),
+                .recordIndex = static_cast<quint32>(i),
+                .reserved = 0,
+            };
+            std::copy_n(entry.key.utf16(), std::min(entry.key.size(), KEY_PREFIX_SIZE), keyEntry.prefix.begin());
+            append(keyTable, keyEntry);
+
+            const QString imageUrl = word.image.url.toString();
+            const Record record {
+                .fields = {
+                    addString(word.name),
+                    addString(word.transcription),
+                    addString(word.translation),
+                    addString(word.association),
+                    addString(word.etymology),
+                    addString(word.description),
+                    addString(imageUrl),
+                },
+                .type = static_cast<qint32>(word.type),
+                .imageWidth = word.image.width,
+                .imageHeight = word.image.height,
+                .reserved = 0,
+                .date = word.date.isValid() ? word.date.toMSecsSinceEpoch() : -1,
+            };
+            append(recordTable, record);
+
+            if (heap.size() > std::numeric_limits<quint32>::max()) {
+                return PackError { "Dictionary pack heap exceeds 4 GiB" };
+            }
+        }
+
+        Header header {
+            .magic = MAGIC,
+            .version = VERSION,
+            .wordCount = static_cast<quint32>(entries.size()),
+            .keyTableOffset = static_cast<quint64>(alignedSize(sizeof(Header))),
+            .recordTableOffset = 0,
+            .heapOffset = 0,
+            .heapSize = static_cast<quint64>(heap.size()),
+        };
+        header.recordTableOffset = header.keyTableOffset + alignedSize(keyTable.size());
+        header.heapOffset = header.recordTableOffset + alignedSize(recordTable.size());
+
+        QByteArray pack;
+        pack.reserve(static_cast<qsizetype>(header.heapOffset) + heap.size());
+
+        append(pack, header);
+        pack.resize(static_cast<qsizetype>(header.keyTableOffset), '\0');
+        pack.append(keyTable);
+        pack.resize(static_cast<qsizetype>(header.recordTableOffset), '\0');
+        pack.append(recordTable);
+        pack.resize(static_cast<qsizetype>(header.heapOffset), '\0');
+        pack.append(heap);
+
+        QSaveFile file(fileName);
+
+        if (!file.open(QIODevice::WriteOnly) || file.write(pack) != pack.size() || !file.commit()) {
+            return PackError { file.errorString() };
+        }
+
+        qInfo() << TAG << "Dictionary pack " << fileName << " written, words: " << entries.size()
+                << ", bytes: " << pack.size() << Qt::endl;
+
+        return static_cast<qsizetype>(entries.size());
+    }
+}
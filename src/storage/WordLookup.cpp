@@ -0,0 +1,174 @@
+/*
+ * Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+ * SPDX-License-Identifier: MIT
+ * Copyright (c) 2023-2025 https://github.com/klappdev
+ *
+ * Permission is hereby  granted, free of charge, to any  person obtaining a copy
+ * of this software and associated  documentation files (the "Software"), to deal
+ * in the Software  without restriction, including without  limitation the rights
+ * to  use, copy,  modify, merge,  publish, distribute,  sublicense, and/or  sell
+ * copies  of  the Software,  and  to  permit persons  to  whom  the Software  is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE  IS PROVIDED "AS  IS", WITHOUT WARRANTY  OF ANY KIND,  EXPRESS OR
+ * IMPLIED,  INCLUDING BUT  NOT  LIMITED TO  THE  WARRANTIES OF  MERCHANTABILITY,
+ * FITNESS FOR  A PARTICULAR PURPOSE AND  NONINFRINGEMENT. IN NO EVENT  SHALL THE
+ * AUTHORS  OR COPYRIGHT  HOLDERS  BE  LIABLE FOR  ANY  CLAIM,  DAMAGES OR  OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF  CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE  OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "storage/WordLookup.hpp"
+#include "util/EnumHelper.hpp"
+
+namespace {
+    constexpr const char* const TAG = "[WordLookup] ";
+}
+
+namespace grunwald {
+
+    WordLookup::WordLookup(WordCache* wordCache, AsyncWordDao* wordDao, WordWriteQueue* writeQueue, QObject* parent)
+        : QObject(parent)
+        , mWordCache(wordCache)
+        , mWordDao(wordDao)
+        , mWriteQueue(writeQueue)
+        , mPromotionCandidates(PROMOTION_CANDIDATES) {
+    }
+
+    WordLookup::~WordLookup() {
+        for (qsizetype i = 0; i < static_cast<qsizetype>(Tier::Count); ++i) {
+            const LatencyHistogram& histogram = mLatencies[static_cast<std::size_t>(i)];
+
+            if (histogram.count() == 0) {
+                continue;
+            }
+
+            qInfo() << TAG << EnumHelper::toString(static_cast<Tier>(i)) << " lookups: " << histogram.count()
+                    << ", p50: " << histogram.percentile(50) << " us, p95: " << histogram.percentile(95)
+                    << " us, p99: " << histogram.percentile(99) << " us" << Qt::endl;
+        }
+    }
+
+    auto WordLookup::open(const QString& packFileName) -> Result<void, PackError> {
+        return mWordPack.open(packFileName);
+    }
+
+    auto WordLookup::lookup(const QString& name, Source source) -> QFuture<Result<std::optional<Hit>, DbError>> {
+        using LookupResult = Result<std::optional<Hit>, DbError>;
+
+        const bool userLookup = source == Source::User;
+
+        QElapsedTimer timer;
+        timer.start();
+
+        if (const WordChange* change = mWriteQueue->pendingChange(name)) {
+            if (userLookup) {
+                recordLatency(Tier::Memory, timer.nsecsElapsed());
+            }
+
+            if (change->type == WordChange::Type::Add) {
+                return QtFuture::makeReadyValueFuture(LookupResult { std::optional<Hit> { Hit { change->word, Tier::Memory } } });
+            }
+
+            /*
+             * The saved copy is about to be deleted, only the pack may still know the word.
+             */
+            return QtFuture::makeReadyValueFuture(LookupResult { lookupPack(name, source) });
+        }
+
+        std::optional<Word> cachedWord = mWordCache->find(name);
+
+        if (userLookup) {
+            recordLatency(Tier::Memory, timer.nsecsElapsed());
+        }
+
+        if (cachedWord) {
+            return QtFuture::makeReadyValueFuture(LookupResult { std::optional<Hit> { Hit { std::move(*cachedWord), Tier::Memory } } });
+        }
+
+        timer.restart();
+
+        return mWordDao->search(name).then(this, [this, name, source, userLookup, timer](const Result<QVector<Word>, DbError>& result) -> LookupResult {
+            if (userLookup) {
+                recordLatency(Tier::Database, timer.nsecsElapsed());
+            }
+
+            if (result.hasError()) {
+                return result.error();
+            }
+
+            /*
+             * The exact headword comes first, folded matches with a queued removal are skipped.
+             */
+            for (const Word& word : result.value()) {
+                if (const WordChange* change = mWriteQueue->pendingChange(word.name);
+                    change != nullptr && change->type == WordChange::Type::Remove) {
+                    continue;
+                }
+
+                if (userLookup) {
+                    promote(word);
+                }
+
+                return std::optional<Hit> { Hit { word, Tier::Database } };
+            }
+
+            return lookupPack(name, source);
+        });
+    }
+
+    void WordLookup::admit(const Word& word, Tier source) {
+        switch (source) {
+            case Tier::Database:
+            case Tier::Origin:
+                mWordCache->insert(word);
+                break;
+            case Tier::Memory:
+            case Tier::Pack:
+            case Tier::Count:
+                break;
+        }
+    }
+
+    void WordLookup::invalidate(const QString& name) {
+        mWordCache->remove(name);
+        mPromotionCandidates.remove(name);
+    }
+
+    void WordLookup::recordLatency(Tier tier, qint64 nsecs) {
+        mLatencies[static_cast<std::size_t>(tier)].record(nsecs);
+    }
+
+    auto WordLookup::latency(Tier tier) const -> const LatencyHistogram& {
+        return mLatencies[static_cast<std::size_t>(tier)];
+    }
+
+    auto WordLookup::lookupPack(const QString& name, Source source) -> std::optional<Hit> {
+        QElapsedTimer timer;
+        timer.start();
+
+        std::optional<Word> packWord = mWordPack.find(name);
+
+        if (source == Source::User) {
+            recordLatency(Tier::Pack, timer.nsecsElapsed());
+        }
+
+        if (!packWord) {
+            return std::nullopt;
+        }
+
+        return Hit { std::move(*packWord), Tier::Pack };
+    }
+
+    void WordLookup::promote(const Word& word) {
+        if (mPromotionCandidates.remove(word.name)) {
+            mWordCache->insert(word);
+        } else {
+            mPromotionCandidates.insert(word.name, new bool(true));
+        }
+    }
+}
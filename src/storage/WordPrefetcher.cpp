@@ -0,0 +1,254 @@
+/*
+ * Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+ * SPDX-License-Identifier: MIT
+ * Copyright (c) 2023-2025 https://github.com/klappdev
+ *
+ * Permission is hereby  granted, free of charge, to any  person obtaining a copy
+ * of this software and associated  documentation files (the "Software"), to deal
+ * in the Software  without restriction, including without  limitation the rights
+ * to  use, copy,  modify, merge,  publish, distribute,  sublicense, and/or  sell
+ * copies  of  the Software,  and  to  permit persons  to  whom  the Software  is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE  IS PROVIDED "AS  IS", WITHOUT WARRANTY  OF ANY KIND,  EXPRESS OR
+ * IMPLIED,  INCLUDING BUT  NOT  LIMITED TO  THE  WARRANTIES OF  MERCHANTABILITY,
+ * FITNESS FOR  A PARTICULAR PURPOSE AND  NONINFRINGEMENT. IN NO EVENT  SHALL THE
+ * AUTHORS  OR COPYRIGHT  HOLDERS  BE  LIABLE FOR  ANY  CLAIM,  DAMAGES OR  OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF  CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE  OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "storage/WordPrefetcher.hpp"
+#include "util/WordNormalizer.hpp"
+
+#include <utility>
+
+namespace {
+    constexpr const char* const TAG = "[WordPrefetcher] ";
+
+    constexpr qint64 NETWORK_BUDGET_WINDOW_MS = 60 * 1000;
+}
+
+namespace grunwald {
+
+    WordPrefetcher::WordPrefetcher(WordLookup* wordLookup, AsyncWordDao* wordDao, const WordSuggestionIndex* suggestionIndex,
+                                   QObject* parent)
+        : QObject(parent)
+        , mWordLookup(wordLookup)
+        , mWordDao(wordDao)
+        , mSuggestionIndex(suggestionIndex)
+        , mGeneration(0)
+        , mPrefetchedKeys(HISTORY_SIZE)
+        , mStats {} {
+        mDebounceTimer.setSingleShot(true);
+        mDebounceTimer.setInterval(DEBOUNCE_MS);
+
+        mPrefetchTimer.setSingleShot(true);
+        mPrefetchTimer.setInterval(PREFETCH_INTERVAL_MS);
+
+        mNetworkClock.start();
+
+        QObject::connect(&mDebounceTimer, &QTimer::timeout, this, &WordPrefetcher::onDebounceFinished);
+        QObject::connect(&mPrefetchTimer, &QTimer::timeout, this, &WordPrefetcher::prefetchNext);
+        QObject::connect(&mWordContentService, &WordContentService::wordContentProcessed,
+                         this, &WordPrefetcher::onWordContentProcessFinished);
+        QObject::connect(&mWordContentService, &WordContentService::wordContentMissed,
+                         this, &WordPrefetcher::onWordContentMissed);
+    }
+
+    WordPrefetcher::~WordPrefetcher() {
+        qInfo() << TAG << "Local prefetches: " << mStats.localPrefetches << ", network prefetches: " << mStats.networkPrefetches
+                << ", useful: " << mStats.usefulPrefetches << Qt::endl;
+    }
+
+    void WordPrefetcher::updatePrefix(const QString& prefix) {
+        /*
+         * Local lookups in flight finish, their answers are dropped by generation.
+         * Network requests of the previous prefix are aborted.
+         */
+        ++mGeneration;
+        mQueue.clear();
+        mOnlineKeys.clear();
+        mPrefetchTimer.stop();
+
+        for (const QPointer<QNetworkReply>& reply : std::exchange(mOnlineReplies, {})) {
+            if (reply != nullptr && reply->isRunning()) {
+                reply->abort();
+            }
+        }
+
+        mPrefix = prefix.trimmed();
+
+        if (WordNormalizer::toKey(mPrefix).size() < MIN_PREFIX_SIZE) {
+            mDebounceTimer.stop();
+            return;
+        }
+
+        mDebounceTimer.start();
+    }
+
+    void WordPrefetcher::recordHistory(const QString& name) {
+        const QString key = WordNormalizer::toKey(name);
+
+        if (key.isEmpty()) {
+            return;
+        }
+
+        mHistory.removeIf([&key](const QString& historyName) {
+            return WordNormalizer::toKey(historyName) == key;
+        });
+        mHistory.prepend(name);
+
+        if (mHistory.size() > HISTORY_SIZE) {
+            mHistory.removeLast();
+        }
+    }
+
+    void WordPrefetcher::recordLookup(const QString& name) {
+        if (mPrefetchedKeys.remove(WordNormalizer::toKey(name))) {
+            ++mStats.usefulPrefetches;
+        }
+    }
+
+    auto WordPrefetcher::stats() const -> Stats {
+        return mStats;
+    }
+
+    void WordPrefetcher::onDebounceFinished() {
+        for (const Candidate& candidate : predict(mPrefix)) {
+            mQueue.enqueue(candidate);
+        }
+
+        prefetchNext();
+    }
+
+    auto WordPrefetcher::predict(const QString& prefix) const -> QVector<Candidate> {
+        const QString prefixKey = WordNormalizer::toKey(prefix);
+
+        QVector<Candidate> candidates;
+        QSet<QString> candidateKeys;
+
+        auto addCandidate = [&](const QString& name, bool fromHistory) {
+            const QString key = WordNormalizer::toKey(name);
+
+            if (candidates.size() < TOP_CANDIDATES && key.startsWith(prefixKey) && !candidateKeys.contains(key)) {
+                candidateKeys.insert(key);
+                candidates.push_back(Candidate { name, fromHistory });
+            }
+        };
+
+        for (const QString& name : mHistory) {
+            addCandidate(name, true);
+        }
+
+        for (const QString& name : mSuggestionIndex->complete(prefix, TOP_CANDIDATES)) {
+            addCandidate(name, false);
+        }
+
+        return candidates;
+    }
+
+    void WordPrefetcher::prefetchNext() {
+        if (mQueue.isEmpty()) {
+            return;
+        }
+
+        const Candidate candidate = mQueue.dequeue();
+        const quint64 generation = mGeneration;
+
+        mWordLookup->lookup(candidate.name, WordLookup::Source::Prefetch).then(this, [this, candidate, generation](const Result<std::optional<WordLookup::Hit>, DbError>& result) {
+            if (generation != mGeneration) {
+                return;
+            }
+
+            if (result.hasError()) {
+                qWarning() << TAG << "Prefetch word " << candidate.name << " failed: " << result.error().getMessage() << Qt::endl;
+            } else if (result.value()) {
+                const WordLookup::Hit& hit = *result.value();
+
+                /*
+                 * Memory hits are warm already, the mapped pack needs no warming.
+                 */
+                if (hit.tier == WordLookup::Tier::Database) {
+                    mWordLookup->admit(hit.word, WordLookup::Tier::Database);
+                    mPrefetchedKeys.insert(WordNormalizer::toKey(hit.word.name), new bool(true));
+                    ++mStats.localPrefetches;
+                }
+            } else if (candidate.fromHistory) {
+                prefetchOnline(candidate.name, generation);
+            }
+
+            if (!mQueue.isEmpty()) {
+                mPrefetchTimer.start();
+            }
+        });
+    }
+
+    void WordPrefetcher::prefetchOnline(const QString& name, quint64 generation) {
+        mWordDao->findMiss(name).then(this, [this, name, generation](const Result<std::optional<WordMiss>, DbError>& result) {
+            if (generation != mGeneration) {
+                return;
+            }
+
+            if (result.hasError()) {
+                qWarning() << TAG << "Check missed word " << name << " failed: " << result.error().getMessage() << Qt::endl;
+                return;
+            }
+
+            if (result.value() || !acquireNetworkBudget()) {
+                return;
+            }
+
+            ++mStats.networkPrefetches;
+            mOnlineKeys.insert(WordNormalizer::toKey(name));
+
+            qInfo() << TAG << "Prefetch word from network: " << name << Qt::endl;
+            mOnlineReplies.push_back(mWordContentService.prefetchWordContent(name));
+        });
+    }
+
+    auto WordPrefetcher::acquireNetworkBudget() -> bool {
+        const qint64 now = mNetworkClock.elapsed();
+
+        while (!mNetworkRequests.isEmpty() && now - mNetworkRequests.head() >= NETWORK_BUDGET_WINDOW_MS) {
+            mNetworkRequests.dequeue();
+        }
+
+        if (!mNetworkRequests.isEmpty() && now - mNetworkRequests.last() < NETWORK_INTERVAL_MS) {
+            return false;
+        }
+
+        if (mNetworkRequests.size() >= NETWORK_BUDGET_PER_MINUTE) {
+            return false;
+        }
+
+        mNetworkRequests.enqueue(now);
+
+        return true;
+    }
+
+    void WordPrefetcher::onWordContentProcessFinished(const Word& word) {
+        /*
+         * The prefix changed since the request, the user is typing something else.
+         */
+        if (!mOnlineKeys.remove(WordNormalizer::toKey(word.name))) {
+            return;
+        }
+
+        mWordLookup->admit(word, WordLookup::Tier::Origin);
+        mPrefetchedKeys.insert(WordNormalizer::toKey(word.name), new bool(true));
+    }
+
+    void WordPrefetcher::onWordContentMissed(const QString& name, qint32 reason) {
+        mOnlineKeys.remove(WordNormalizer::toKey(name));
+
+        /*
+         * A miss stays true after the prefix changed, it is remembered either way.
+         */
+        emit wordMissed(name, reason);
+    }
+}
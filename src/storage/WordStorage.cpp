@@ -23,28 +23,104 @@
  */
 
 #include "storage/WordStorage.hpp"
+#include "net/WordNetworkCache.hpp"
+#include "util/EnumHelper.hpp"
 
 #include <algorithm>
 
 namespace {
     constexpr const char* const TAG = "[WordStorage] ";
+
+    constexpr qsizetype SUGGESTIONS_LIMIT = 5;
+    constexpr qint32 MAX_SUGGESTION_DISTANCE = 2;
+
+    constexpr const char* const PACK_FILE = "grunwald.pack";
+
+    /*
+     * Missing pages may be created soon, a page without German section rarely changes.
+     */
+    constexpr qint64 NOT_FOUND_TTL_DAYS = 3;
+    constexpr qint64 LANGUAGE_NOT_FOUND_TTL_DAYS = 30;
+    constexpr qint32 MAX_MISSES = 5000;
 }
 
 namespace grunwald {
 
-    WordStorage::WordStorage(WordCache* wordCache) : mWordCache(wordCache) {
+    WordStorage::WordStorage(WordCache* wordCache, WordImageCache* imageCache, WordWriteQueue::Durability durability)
+        : mWordCache(wordCache)
+        , mImageCache(imageCache)
+        , mWordSaved(false)
+        , mSearchGeneration(0)
+        , mWordMaintenance(&mWordDao)
+        , mWriteQueue(&mWordDao, durability)
+        , mWordLookup(wordCache, &mWordDao, &mWriteQueue)
+        , mWordPrefetcher(&mWordLookup, &mWordDao, &mSuggestionIndex) {
 
         QObject::connect(&mWordContentService, &WordContentService::wordContentProcessed,
                          this, &WordStorage::onWordContentProcessFinished);
         QObject::connect(&mWordContentService, &WordContentService::wordContentErrorProcessed,
                          this, &WordStorage::onWordProcessErrorFinished);
+        QObject::connect(&mWordContentService, &WordContentService::wordContentMissed,
+                         this, &WordStorage::onWordContentMissed);
+        QObject::connect(&mWordPrefetcher, &WordPrefetcher::wordMissed,
+                         this, &WordStorage::recordMiss);
+        QObject::connect(&mWriteQueue, &WordWriteQueue::changeFailed,
+                         this, &WordStorage::onWordChangeFailed);
+
+        if (const auto opened = mWordLookup.open(PACK_FILE); opened.hasError()) {
+            qInfo() << TAG << "Dictionary pack isn't available: " << opened.error().getMessage() << Qt::endl;
+        }
+
+        mWordDao.getNames().then(this, [this](const Result<QStringList, DbError>& result) {
+            if (result.hasError()) {
+                qWarning() << TAG << "Load names for suggestions failed: " << result.error().getMessage() << Qt::endl;
+                return;
+            }
+
+            mSuggestionIndex.reset(result.value());
+
+            qInfo() << TAG << "Suggestion index has " << mSuggestionIndex.size() << " words" << Qt::endl;
+        });
     }
 
     WordStorage::~WordStorage() {
+        const WordNetworkCache::Stats networkStats = WordNetworkCache::stats();
+
+        qInfo() << TAG << "Network cache hits: " << networkStats.hits << ", misses: " << networkStats.misses
+                << ", revalidated: " << networkStats.revalidated << ", stored: " << networkStats.stored << Qt::endl;
     }
 
     bool WordStorage::isWordCached() const {
-        return mWordCache->isValid();
+        return mWordSaved;
+    }
+
+    void WordStorage::setWordSaved(bool saved) {
+        if (mWordSaved != saved) {
+            mWordSaved = saved;
+            emit wordCachedChanged();
+        }
+    }
+
+    void WordStorage::updateWordSaved(const QString& name) {
+        /*
+         * A queued change is not visible to the database thread yet.
+         */
+        if (const WordChange* change = mWriteQueue.pendingChange(name); change != nullptr) {
+            setWordSaved(change->type == WordChange::Type::Add);
+            return;
+        }
+
+        mWordDao.checkIfExists(name).then(this, [this, name](bool exists) {
+            const std::shared_ptr<const Word> currentWord = mWordCache->loadSnapshot();
+
+            if (currentWord != nullptr && currentWord->name == name) {
+                setWordSaved(exists);
+            }
+        });
+    }
+
+    auto WordStorage::loadWordImage(qint64 imageId, const QSize& scaledSize) -> QFuture<Result<QImage, DbError>> {
+        return mWordDao.loadImage(imageId, scaledSize);
     }
 
     auto WordStorage::prepareWords(const QList<Word>& words) -> QVariantList {
@@ -58,96 +134,264 @@ namespace grunwald {
         return variantWords;
     }
 
-    void WordStorage::preloadWords() {
-        Result<QVector<Word>, DbError> result = mWordDao.getAll();
-
-        if (result.hasValue() && !result.value().isEmpty()) {
-            QList<Word> localWords = result.value();
-            QVariantList variantWords = prepareWords(localWords);
+    auto WordStorage::loadWordsPage(const QString& afterName, qint64 afterId) -> QFuture<Result<QVector<Word>, DbError>> {
+        return mWordDao.page(afterName, afterId, WORDS_PAGE_SIZE);
+    }
 
-            if (!localWords.isEmpty()) {
-                mWordCache->storeWordContent(localWords.at(0));
-            }
+    void WordStorage::preloadWords() {
+        const quint64 generation = mSearchGeneration;
 
-            qInfo() << TAG << "Load all words from db success!" << Qt::endl;
-            emit localWordsHandled(QVariant::fromValue(variantWords));
-        } else {
-            mWordCache->clear();
+        mWordDao.page(QString{}, 0, WORDS_PAGE_SIZE).then(this, [this, generation](const Result<QVector<Word>, DbError>& result) {
+            if (result.hasValue() && !result.value().isEmpty()) {
+                QList<Word> localWords = result.value();
+                QVariantList variantWords = prepareWords(localWords);
+
+                /*
+                 * A search started meanwhile owns the current word.
+                 */
+                if (!localWords.isEmpty() && generation == mSearchGeneration) {
+                    mWordCache->storeWordContent(localWords.at(0));
+                    setWordSaved(true);
+                }
+
+                qInfo() << TAG << "Load first page of words from db success!" << Qt::endl;
+                emit localWordsHandled(QVariant::fromValue(variantWords), localWords.size() >= WORDS_PAGE_SIZE);
+            } else {
+                mWordCache->clear();
+                setWordSaved(false);
 
-            const QString errorMessage = "Error load all words from db: " + (result.hasError() ? result.error().getMessage() : "unknown");
+                const QString errorMessage = "Error load words from db: " + (result.hasError() ? result.error().getMessage() : "unknown");
 
-            qWarning() << TAG << errorMessage << Qt::endl;
-            emit wordErrorHandled(errorMessage);
-        }
+                qWarning() << TAG << errorMessage << Qt::endl;
+                emit wordErrorHandled(errorMessage);
+            }
+        });
     }
 
     void WordStorage::searchWord(const QString& name) {
-        if (mWordDao.checkIfExists(name)) {
-            Result<QVector<Word>, DbError> result = mWordDao.search(name);
+        mWordPrefetcher.recordLookup(name);
 
-            if (result.hasValue() && !result.value().isEmpty()) {
-                auto searchedWord = result.value().at(0);
-                mWordCache->storeWordContent(searchedWord);
+        const quint64 generation = ++mSearchGeneration;
+        mOnlineName.clear();
 
+        mWordLookup.lookup(name).then(this, [this, name, generation](const Result<std::optional<WordLookup::Hit>, DbError>& result) {
+            if (generation != mSearchGeneration) {
+                qDebug() << TAG << "Drop result of an older search: " << name << Qt::endl;
+                return;
+            }
 
-                qInfo() << TAG << "Search word into db: " << searchedWord.name << " success!" << Qt::endl;
-                emit wordContentHandled(searchedWord);
-            } else {
+            if (result.hasError()) {
                 mWordCache->clear();
+                setWordSaved(false);
 
                 const QString errorMessage = "Error search word into db: " + result.error().getMessage();
 
                 qWarning() << TAG << errorMessage << Qt::endl;
                 emit wordErrorHandled(errorMessage);
+            } else if (result.value()) {
+                const WordLookup::Hit& hit = *result.value();
+                mWordCache->storeWordContent(hit.word);
+                mWordPrefetcher.recordHistory(hit.word.name);
+
+                /*
+                 * Memory keeps words fetched online too, only a database hit is known to be saved.
+                 */
+                if (hit.tier == WordLookup::Tier::Database) {
+                    setWordSaved(true);
+                } else {
+                    updateWordSaved(hit.word.name);
+                }
+
+                qInfo() << TAG << "Search word into " << EnumHelper::toString(hit.tier) << ": " << hit.word.name << " success!" << Qt::endl;
+                emit wordContentHandled(hit.word);
+            } else {
+                suggestWord(name, generation);
             }
-        } else {
-            mWordCache->clear();
-            mWordContentService.fetchWordContent(name);
+        });
+    }
+
+    void WordStorage::suggestWord(const QString& name, quint64 generation) {
+        const QStringList suggestions = mSuggestionIndex.suggest(name, SUGGESTIONS_LIMIT, MAX_SUGGESTION_DISTANCE);
+
+        if (suggestions.isEmpty()) {
+            searchWordRemote(name, generation);
+            return;
         }
+
+        qInfo() << TAG << "Word " << name << " isn't saved, suggest: " << suggestions << Qt::endl;
+        emit wordSuggestionsHandled(name, suggestions);
     }
 
-    void WordStorage::insertWord() {
-        Word word = mWordCache->loadWordContent();
+    void WordStorage::searchWordRemote(const QString& name, quint64 generation) {
+        mWordDao.findMiss(name).then(this, [this, name, generation](const Result<std::optional<WordMiss>, DbError>& result) {
+            if (generation != mSearchGeneration) {
+                return;
+            }
+
+            if (result.hasValue() && result.value()) {
+                mWordCache->clear();
+                setWordSaved(false);
 
-        Result<void, DbError> result = mWordDao.add(word);
+                const QString errorMessage = "Word " + name + " was not found online, next search after " +
+                                             result.value()->expiresAt.toString(Qt::ISODate);
 
-        if (result.hasError()) {
-            const QString errorMessage = "Error save word into db: " + result.error().getMessage();
+                qInfo() << TAG << errorMessage << Qt::endl;
+                emit wordErrorHandled(errorMessage);
+                return;
+            }
 
-            qWarning() << TAG << errorMessage << Qt::endl;
-            emit wordErrorHandled(errorMessage);
-        } else {
-            const QString infoMessage = "Save word into db: " + word.name + " success!";
+            fetchWordOnline(name);
+        });
+    }
 
-            qInfo() << TAG << infoMessage << Qt::endl;
-        }
+    void WordStorage::searchWordOnline(const QString& name) {
+        ++mSearchGeneration;
+        fetchWordOnline(name);
+    }
+
+    void WordStorage::fetchWordOnline(const QString& name) {
+        mOnlineName = name;
+        mOriginTimer.start();
+        mWordCache->clear();
+        setWordSaved(false);
+        mWordContentService.fetchWordContent(name);
+    }
+
+    void WordStorage::prefetchWords(const QString& prefix) {
+        mWordPrefetcher.updatePrefix(prefix);
+    }
+
+    void WordStorage::fullTextSearch(const QString& text, qint32 limit) {
+        mWordDao.fullTextSearch(text, limit).then(this, [this, text](const Result<QVector<Word>, DbError>& result) {
+            if (result.hasValue()) {
+                QVariantList variantWords = prepareWords(result.value());
+
+                qInfo() << TAG << "Full text search words into db: " << text << ", found " << variantWords.size() << Qt::endl;
+                emit fullTextWordsHandled(text, QVariant::fromValue(variantWords));
+            } else {
+                const QString errorMessage = "Error full text search words into db: " + result.error().getMessage();
+
+                qWarning() << TAG << errorMessage << Qt::endl;
+                emit wordErrorHandled(errorMessage);
+            }
+        });
+    }
+
+    void WordStorage::insertWord() {
+        Word word = mWordCache->loadWordContent();
+
+        mWriteQueue.enqueue(WordChange { WordChange::Type::Add, word });
+        mSuggestionIndex.insert(word.name);
+        mWordLookup.admit(word, WordLookup::Tier::Database);
+        mImageCache->remove(word.name);
+        setWordSaved(true);
+
+        qInfo() << TAG << "Save word into db: " << word.name << " queued" << Qt::endl;
     }
 
     void WordStorage::removeWord() {
         Word word = mWordCache->loadWordContent();
 
-        Result<void, DbError> result = mWordDao.remove(word);
+        mWriteQueue.enqueue(WordChange { WordChange::Type::Remove, word });
+        mSuggestionIndex.remove(word.name);
+        mWordLookup.invalidate(word.name);
+        mImageCache->remove(word.name);
+        setWordSaved(false);
+
+        qInfo() << TAG << "Remove word from db: " << word.name << " queued" << Qt::endl;
+    }
 
-        if (result.hasError()) {
-            const QString errorMessage = "Error remove word from db: " + result.error().getMessage();
+    void WordStorage::onWordChangeFailed(const WordChange& change, const QString& error) {
+        QString errorMessage;
 
-            qWarning() << TAG << errorMessage << Qt::endl;
-            emit wordErrorHandled(errorMessage);
+        /*
+         * The suggestion index was updated optimistically, the change is taken back.
+         */
+        if (change.type == WordChange::Type::Add) {
+            mSuggestionIndex.remove(change.word.name);
+            errorMessage = "Error save word into db: " + error;
         } else {
-            const QString infoMessage = "Remove word from db: " + word.name + " success!";
+            mSuggestionIndex.insert(change.word.name);
+            errorMessage = "Error remove word from db: " + error;
+        }
 
-            qInfo() << TAG << infoMessage << Qt::endl;
+        if (const std::shared_ptr<const Word> currentWord = mWordCache->loadSnapshot();
+            currentWord != nullptr && currentWord->name == change.word.name) {
+            setWordSaved(change.type == WordChange::Type::Remove);
         }
+
+        qWarning() << TAG << errorMessage << Qt::endl;
+        emit wordErrorHandled(errorMessage);
     }
 
     void WordStorage::onWordContentProcessFinished(const Word& searchedWord) {
+        /*
+         * The user searched something else meanwhile, the answer only warms the memory tier.
+         */
+        if (searchedWord.name != mOnlineName) {
+            mWordLookup.admit(searchedWord, WordLookup::Tier::Origin);
+            return;
+        }
+
+        mOnlineName.clear();
+
+        if (mOriginTimer.isValid()) {
+            mWordLookup.recordLatency(WordLookup::Tier::Origin, mOriginTimer.nsecsElapsed());
+            mOriginTimer.invalidate();
+        }
+
+        mWordLookup.admit(searchedWord, WordLookup::Tier::Origin);
         mWordCache->storeWordContent(searchedWord);
+        mWordPrefetcher.recordHistory(searchedWord.name);
+        updateWordSaved(searchedWord.name);
 
         qInfo() << TAG << "Search word from network: " << searchedWord.name << " success!" << Qt::endl;
         emit wordContentHandled(searchedWord);
     }
 
-    void WordStorage::onWordProcessErrorFinished(const QString& errorMessage) {
+    void WordStorage::onWordContentMissed(const QString& name, qint32 reason, const QString& errorMessage) {
+        recordMiss(name, reason);
+        onWordProcessErrorFinished(name, errorMessage);
+    }
+
+    void WordStorage::recordMiss(const QString& name, qint32 reason) {
+        qint64 ttlDays = 0;
+
+        /*
+         * Only answers of the dictionary itself are remembered, a malformed page may parse next time.
+         */
+        switch (static_cast<ParserErrorCode>(reason)) {
+            case ParserErrorCode::NotFound:
+                ttlDays = NOT_FOUND_TTL_DAYS;
+                break;
+            case ParserErrorCode::LanguageNotFound:
+                ttlDays = LANGUAGE_NOT_FOUND_TTL_DAYS;
+                break;
+            case ParserErrorCode::Malformed:
+                return;
+        }
+
+        if (ttlDays == 0) {
+            return;
+        }
+
+        const WordMiss miss { name, reason, QDateTime::currentDateTime().addDays(ttlDays) };
+
+        mWordDao.addMiss(miss, MAX_MISSES).then(this, [name](const Result<void, DbError>& result) {
+            if (result.hasError()) {
+                qWarning() << TAG << "Remember missed word " << name << " failed: " << result.error().getMessage() << Qt::endl;
+            }
+        });
+    }
+
+    void WordStorage::onWordProcessErrorFinished(const QString& name, const QString& errorMessage) {
+        if (name != mOnlineName) {
+            return;
+        }
+
+        mOnlineName.clear();
+        mOriginTimer.invalidate();
+
         const QString extendedErrorMessage = "Error search word from network: " + errorMessage;
 
         qWarning() << TAG << extendedErrorMessage << Qt::endl;
@@ -0,0 +1,292 @@
+/*
+ * Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+ * SPDX-License-Identifier: MIT
+ * Copyright (c) 2023-2025 https://github.com/klappdev
+ *
+ * Permission is hereby  granted, free of charge, to any  person obtaining a copy
+ * of this software and associated  documentation files (the "Software"), to deal
+ * in the Software  without restriction, including without  limitation the rights
+ * to  use, copy,  modify, merge,  publish, distribute,  sublicense, and/or  sell
+ * copies  of  the Software,  and  to  permit persons  to  whom  the Software  is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE  IS PROVIDED "AS  IS", WITHOUT WARRANTY  OF ANY KIND,  EXPRESS OR
+ * IMPLIED,  INCLUDING BUT  NOT  LIMITED TO  THE  WARRANTIES OF  MERCHANTABILITY,
+ * FITNESS FOR  A PARTICULAR PURPOSE AND  NONINFRINGEMENT. IN NO EVENT  SHALL THE
+ * AUTHORS  OR COPYRIGHT  HOLDERS  BE  LIABLE FOR  ANY  CLAIM,  DAMAGES OR  OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF  CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE  OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "storage/WordSuggestionIndex.hpp"
+#include "util/WordNormalizer.hpp"
+
+#include <algorithm>
+
+namespace {
+    /*
+     * Removed entries are compacted away once they make up a quarter of the index.
+     */
+    constexpr qsizetype COMPACTION_MIN_REMOVED = 64;
+    constexpr qsizetype COMPACTION_RATIO = 4;
+}
+
+namespace grunwald {
+
+    void WordSuggestionIndex::reset(const QStringList& names) {
+        mEntries.clear();
+        mEntryIndexes.clear();
+        mRemovedIndexes.clear();
+        mPostings.clear();
+
+        mEntries.reserve(names.size());
+
+        for (const QString& name : names) {
+            insert(name);
+        }
+    }
+
+    void WordSuggestionIndex::insert(const QString& name) {
+        const QString key = WordNormalizer::toKey(name);
+
+        if (key.isEmpty()) {
+            return;
+        }
+
+        if (mEntryIndexes.contains(name)) {
+            return;
+        }
+
+        /*
+         * The same name has the same trigrams, so postings of a removed entry still fit.
+         */
+        if (auto it = mRemovedIndexes.constFind(name); it != mRemovedIndexes.cend()) {
+            const qint32 entryIndex = it.value();
+            mRemovedIndexes.erase(it);
+
+            mEntries[entryIndex].removed = false;
+            mEntryIndexes.insert(name, entryIndex);
+            return;
+        }
+
+        const QVector<quint64> trigrams = prepareTrigrams(key);
+        const qint32 entryIndex = static_cast<qint32>(mEntries.size());
+
+        mEntries.push_back(Entry { name, key, static_cast<qint32>(trigrams.size()), false });
+        mEntryIndexes.insert(name, entryIndex);
+
+        for (quint64 trigram : trigrams) {
+            mPostings[trigram].push_back(entryIndex);
+        }
+    }
+
+    void WordSuggestionIndex::remove(const QString& name) {
+        const auto it = mEntryIndexes.constFind(name);
+
+        if (it == mEntryIndexes.cend()) {
+            return;
+        }
+
+        /*
+         * Postings keep the index of a removed entry, lookups skip it.
+         */
+        mEntries[it.value()].removed = true;
+        mRemovedIndexes.insert(it.key(), it.value());
+        mEntryIndexes.erase(it);
+
+        if (mRemovedIndexes.size() >= COMPACTION_MIN_REMOVED && mRemovedIndexes.size() * COMPACTION_RATIO >= mEntries.size()) {
+            compact();
+        }
+    }
+
+    void WordSuggestionIndex::compact() {
+        QStringList names;
+        names.reserve(mEntryIndexes.size());
+
+        for (const Entry& entry : std::as_const(mEntries)) {
+            if (!entry.removed) {
+                names.push_back(entry.name);
+            }
+        }
+
+        reset(names);
+    }
+
+    auto WordSuggestionIndex::size() const -> qsizetype {
+        return mEntryIndexes.size();
+    }
+
+    auto WordSuggestionIndex::suggest(const QString& name, qsizetype limit, qint32 maxDistance) const -> QStringList {
+        const QString key = WordNormalizer::toKey(name);
+        const QVector<quint64> trigrams = prepareTrigrams(key);
+
+        QHash<qint32, qint32> sharedTrigrams;
+
+        for (quint64 trigram : trigrams) {
+            if (auto it = mPostings.constFind(trigram); it != mPostings.cend()) {
+                for (qint32 entryIndex : it.value()) {
+                    ++sharedTrigrams[entryIndex];
+                }
+            }
+        }
+
+        struct Candidate final {
+            qint32 entryIndex;
+            qint32 distance;
+            qint32 sharedTrigrams;
+        };
+
+        QVector<Candidate> candidates;
+
+        for (auto it = sharedTrigrams.cbegin(); it != sharedTrigrams.cend(); ++it) {
+            const Entry& entry = mEntries.at(it.key());
+
+            if (entry.removed || entry.key == key) {
+                continue;
+            }
+
+            /*
+             * One edit changes at most three trigrams, so candidates
+             * sharing too few of them can't be within maxDistance.
+             */
+            const qint32 requiredTrigrams = qMax(entry.trigramCount, static_cast<qint32>(trigrams.size())) - 3 * maxDistance;
+
+            if (it.value() < requiredTrigrams) {
+                continue;
+            }
+
+            const qint32 distance = editDistance(key, entry.key, maxDistance);
+
+            if (distance <= maxDistance) {
+                candidates.push_back(Candidate { it.key(), distance, it.value() });
+            }
+        }
+
+        std::sort(candidates.begin(), candidates.end(), [this](const Candidate& left, const Candidate& right) {
+            if (left.distance != right.distance) {
+                return left.distance < right.distance;
+            }
+
+            if (left.sharedTrigrams != right.sharedTrigrams) {
+                return left.sharedTrigrams > right.sharedTrigrams;
+            }
+
+            return mEntries.at(left.entryIndex).key < mEntries.at(right.entryIndex).key;
+        });
+
+        QStringList suggestions;
+
+        for (qsizetype i = 0; i < qMin(limit, candidates.size()); ++i) {
+            suggestions.push_back(mEntries.at(candidates.at(i).entryIndex).name);
+        }
+
+        return suggestions;
+    }
+
+    auto WordSuggestionIndex::complete(const QString& prefix, qsizetype limit) const -> QStringList {
+        const QString key = WordNormalizer::toKey(prefix);
+
+        if (key.size() < 2) {
+            return {};
+        }
+
+        /*
+         * Every completion holds the word start trigram of the prefix.
+         */
+        const quint64 startTrigram = static_cast<quint64>(u' ') << 32 |
+                                     static_cast<quint64>(key.at(0).unicode()) << 16 |
+                                     static_cast<quint64>(key.at(1).unicode());
+        const auto postings = mPostings.constFind(startTrigram);
+
+        if (postings == mPostings.cend()) {
+            return {};
+        }
+
+        QVector<qint32> candidates;
+
+        for (qint32 entryIndex : postings.value()) {
+            const Entry& entry = mEntries.at(entryIndex);
+
+            if (!entry.removed && entry.key.startsWith(key)) {
+                candidates.push_back(entryIndex);
+            }
+        }
+
+        std::sort(candidates.begin(), candidates.end(), [this](qint32 left, qint32 right) {
+            const Entry& leftEntry = mEntries.at(left);
+            const Entry& rightEntry = mEntries.at(right);
+
+            if (leftEntry.key.size() != rightEntry.key.size()) {
+                return leftEntry.key.size() < rightEntry.key.size();
+            }
+
+            return leftEntry.key < rightEntry.key;
+        });
+
+        QStringList completions;
+
+        for (qsizetype i = 0; i < qMin(limit, candidates.size()); ++i) {
+            completions.push_back(mEntries.at(candidates.at(i)).name);
+        }
+
+        return completions;
+    }
+
+    auto WordSuggestionIndex::prepareTrigrams(const QString& key) -> QVector<quint64> {
+        /*
+         * Padding gives word boundaries their own trigrams, so short words still match.
+         */
+        const QString paddedKey = "  " + key + ' ';
+
+        QVector<quint64> trigrams;
+        trigrams.reserve(paddedKey.size());
+
+        for (qsizetype i = 0; i + 2 < paddedKey.size(); ++i) {
+            trigrams.push_back(static_cast<quint64>(paddedKey.at(i).unicode()) << 32 |
+                               static_cast<quint64>(paddedKey.at(i + 1).unicode()) << 16 |
+                               static_cast<quint64>(paddedKey.at(i + 2).unicode()));
+        }
+
+        std::sort(trigrams.begin(), trigrams.end());
+        trigrams.erase(std::unique(trigrams.begin(), trigrams.end()), trigrams.end());
+
+        return trigrams;
+    }
+
+    auto WordSuggestionIndex::editDistance(QStringView left, QStringView right, qint32 maxDistance) -> qint32 {
+        if (qAbs(left.size() - right.size()) > maxDistance) {
+            return maxDistance + 1;
+        }
+
+        QVector<qint32> previousRow(right.size() + 1);
+        QVector<qint32> currentRow(right.size() + 1);
+
+        for (qsizetype j = 0; j <= right.size(); ++j) {
+            previousRow[j] = static_cast<qint32>(j);
+        }
+
+        for (qsizetype i = 1; i <= left.size(); ++i) {
+            currentRow[0] = static_cast<qint32>(i);
+            qint32 rowMinimum = currentRow[0];
+
+            for (qsizetype j = 1; j <= right.size(); ++j) {
+                const qint32 substitution = previousRow[j - 1] + (left.at(i - 1) == right.at(j - 1) ? 0 : 1);
+
+                currentRow[j] = qMin(substitution, qMin(previousRow[j], currentRow[j - 1]) + 1);
+                rowMinimum = qMin(rowMinimum, currentRow[j]);
+            }
+
+            if (rowMinimum > maxDistance) {
+                return maxDistance + 1;
+            }
+
+            std::swap(previousRow, currentRow);
+        }
+
+        return previousRow[right.size()];
+    }
+}
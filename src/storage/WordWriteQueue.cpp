@@ -0,0 +1,110 @@
+/*
+ * Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+ * SPDX-License-Identifier: MIT
+ * Copyright (c) 2023-2025 https://github.com/klappdev
+ *
+ * Permission is hereby  granted, free of charge, to any  person obtaining a copy
+ * of this software and associated  documentation files (the "Software"), to deal
+ * in the Software  without restriction, including without  limitation the rights
+ * to  use, copy,  modify, merge,  publish, distribute,  sublicense, and/or  sell
+ * copies  of  the Software,  and  to  permit persons  to  whom  the Software  is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE  IS PROVIDED "AS  IS", WITHOUT WARRANTY  OF ANY KIND,  EXPRESS OR
+ * IMPLIED,  INCLUDING BUT  NOT  LIMITED TO  THE  WARRANTIES OF  MERCHANTABILITY,
+ * FITNESS FOR  A PARTICULAR PURPOSE AND  NONINFRINGEMENT. IN NO EVENT  SHALL THE
+ * AUTHORS  OR COPYRIGHT  HOLDERS  BE  LIABLE FOR  ANY  CLAIM,  DAMAGES OR  OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF  CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE  OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "storage/WordWriteQueue.hpp"
+
+#include <utility>
+
+namespace {
+    constexpr const char* const TAG = "[WordWriteQueue] ";
+}
+
+namespace grunwald {
+
+    WordWriteQueue::WordWriteQueue(AsyncWordDao* wordDao, Durability durability, QObject* parent)
+        : QObject(parent)
+        , mWordDao(wordDao)
+        , mDurability(durability) {
+        mFlushTimer.setSingleShot(true);
+        mFlushTimer.setInterval(FLUSH_INTERVAL_MS);
+
+        QObject::connect(&mFlushTimer, &QTimer::timeout, this, &WordWriteQueue::flush);
+    }
+
+    WordWriteQueue::~WordWriteQueue() {
+        mFlushTimer.stop();
+
+        if (mChanges.isEmpty()) {
+            return;
+        }
+
+        /*
+         * The continuation of flush() would need this object, the last batch is awaited here instead.
+         */
+        const QVector<WordChange> changes = std::exchange(mChanges, {});
+        const QVector<Result<void, DbError>> results = mWordDao->applyBatch(changes).result();
+
+        for (qsizetype i = 0; i < results.size(); ++i) {
+            if (results.at(i).hasError()) {
+                qWarning() << TAG << "Word change of " << changes.at(i).word.name << " was lost: "
+                           << results.at(i).error().getMessage() << Qt::endl;
+            }
+        }
+    }
+
+    void WordWriteQueue::enqueue(const WordChange& change) {
+        /*
+         * By exact name, headwords sharing a folded key are different words.
+         */
+        if (auto it = mChangeIndexes.constFind(change.word.name); it != mChangeIndexes.cend()) {
+            mChanges[it.value()] = change;
+        } else {
+            mChangeIndexes.insert(change.word.name, mChanges.size());
+            mChanges.push_back(change);
+        }
+
+        if (mDurability == Durability::Immediate || mChanges.size() >= FLUSH_CHANGES) {
+            flush();
+        } else if (!mFlushTimer.isActive()) {
+            mFlushTimer.start();
+        }
+    }
+
+    auto WordWriteQueue::pendingChange(const QString& name) const -> const WordChange* {
+        const auto it = mChangeIndexes.constFind(name);
+
+        return it != mChangeIndexes.cend() ? &mChanges.at(it.value()) : nullptr;
+    }
+
+    auto WordWriteQueue::flush() -> QFuture<void> {
+        mFlushTimer.stop();
+
+        if (mChanges.isEmpty()) {
+            return QtFuture::makeReadyVoidFuture();
+        }
+
+        const QVector<WordChange> changes = std::exchange(mChanges, {});
+        mChangeIndexes.clear();
+
+        qDebug() << TAG << "Flush " << changes.size() << " word changes" << Qt::endl;
+
+        return mWordDao->applyBatch(changes).then(this, [this, changes](const QVector<Result<void, DbError>>& results) {
+            for (qsizetype i = 0; i < results.size(); ++i) {
+                if (results.at(i).hasError()) {
+                    emit changeFailed(changes.at(i), results.at(i).error().getMessage());
+                }
+            }
+        });
+    }
+}
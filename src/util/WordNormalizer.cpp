@@ -0,0 +1,117 @@
+/*
+ * Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+ * SPDX-License-Identifier: MIT
+ * Copyright (c) 2023-2025 https://github.com/klappdev
+ *
+ * Permission is hereby  granted, free of charge, to any  person obtaining a copy
+ * of this software and associated  documentation files (the "Software"), to deal
+ * in the Software  without restriction, including without  limitation the rights
+ * to  use, copy,  modify, merge,  publish, distribute,  sublicense, and/or  sell
+ * copies  of  the Software,  and  to  permit persons  to  whom  the Software  is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE  IS PROVIDED "AS  IS", WITHOUT WARRANTY  OF ANY KIND,  EXPRESS OR
+ * IMPLIED,  INCLUDING BUT  NOT  LIMITED TO  THE  WARRANTIES OF  MERCHANTABILITY,
+ * FITNESS FOR  A PARTICULAR PURPOSE AND  NONINFRINGEMENT. IN NO EVENT  SHALL THE
+ * AUTHORS  OR COPYRIGHT  HOLDERS  BE  LIABLE FOR  ANY  CLAIM,  DAMAGES OR  OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF  CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE  OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "util/WordNormalizer.hpp"
+
+#if defined(__SSE2__) || defined(_M_X64)
+#   include <emmintrin.h>
+#   define GRUNWALD_NORMALIZER_SSE2
+#endif
+
+namespace {
+
+    /*
+     * Lowercases ASCII letters in place, returns false as soon as
+     * a non-ASCII code unit is found so the caller takes the full path.
+     */
+    auto foldAscii(char16_t* data, qsizetype size) -> bool {
+        qsizetype i = 0;
+
+#ifdef GRUNWALD_NORMALIZER_SSE2
+        const __m128i asciiMask = _mm_set1_epi16(static_cast<short>(0xff80));
+        const __m128i upperFirst = _mm_set1_epi16('A' - 1);
+        const __m128i upperLast = _mm_set1_epi16('Z' + 1);
+        const __m128i caseBit = _mm_set1_epi16(0x20);
+
+        for (; i + 8 <= size; i += 8) {
+            __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i));
+
+            if (_mm_movemask_epi8(_mm_cmpeq_epi16(_mm_and_si128(chunk, asciiMask), _mm_setzero_si128())) != 0xffff) {
+                return false;
+            }
+
+            const __m128i upperCase = _mm_and_si128(_mm_cmpgt_epi16(chunk, upperFirst), _mm_cmplt_epi16(chunk, upperLast));
+            chunk = _mm_or_si128(chunk, _mm_and_si128(upperCase, caseBit));
+
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(data + i), chunk);
+        }
+#endif
+
+        for (; i < size; ++i) {
+            if (data[i] >= 0x80) {
+                return false;
+            }
+
+            if (data[i] >= u'A' && data[i] <= u'Z') {
+                data[i] |= 0x20;
+            }
+        }
+
+        return true;
+    }
+
+    auto foldGerman(const QString& name) -> QString {
+        const QString foldedName = name.normalized(QString::NormalizationForm_C).toCaseFolded();
+
+        QString expandedName;
+        expandedName.reserve(foldedName.size() + 4);
+
+        for (QChar letter : foldedName) {
+            switch (letter.unicode()) {
+            case u'ä': expandedName += u"ae"; break;
+            case u'ö': expandedName += u"oe"; break;
+            case u'ü': expandedName += u"ue"; break;
+            case u'ß':
+            case u'ẞ': expandedName += u"ss"; break;
+            default:   expandedName += letter; break;
+            }
+        }
+
+        const QString decomposedName = expandedName.normalized(QString::NormalizationForm_D);
+
+        QString key;
+        key.reserve(decomposedName.size());
+
+        for (QChar letter : decomposedName) {
+            if (letter.category() != QChar::Mark_NonSpacing) {
+                key += letter;
+            }
+        }
+
+        return key;
+    }
+}
+
+namespace grunwald::WordNormalizer {
+
+    auto toKey(QStringView name) -> QString {
+        QString key = name.trimmed().toString();
+
+        if (foldAscii(reinterpret_cast<char16_t*>(key.data()), key.size())) {
+            return key;
+        }
+
+        return foldGerman(key);
+    }
+}
@@ -0,0 +1,193 @@
+/*
+ * Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+ * SPDX-License-Identifier: MIT
+ * Copyright (c) 2023-2025 https://github.com/klappdev
+ *
+ * Permission is hereby  granted, free of charge, to any  person obtaining a copy
+ * of this software and associated  documentation files (the "Software"), to deal
+ * in the Software  without restriction, including without  limitation the rights
+ * to  use, copy,  modify, merge,  publish, distribute,  sublicense, and/or  sell
+ * copies  of  the Software,  and  to  permit persons  to  whom  the Software  is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE  IS PROVIDED "AS  IS", WITHOUT WARRANTY  OF ANY KIND,  EXPRESS OR
+ * IMPLIED,  INCLUDING BUT  NOT  LIMITED TO  THE  WARRANTIES OF  MERCHANTABILITY,
+ * FITNESS FOR  A PARTICULAR PURPOSE AND  NONINFRINGEMENT. IN NO EVENT  SHALL THE
+ * AUTHORS  OR COPYRIGHT  HOLDERS  BE  LIABLE FOR  ANY  CLAIM,  DAMAGES OR  OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF  CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE  OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <QtTest>
+
+#include "cache/WordCache.hpp"
+#include "common/WordFixtures.hpp"
+
+#include <atomic>
+#include <thread>
+
+using namespace grunwald;
+
+namespace {
+    constexpr qint64 BYTE_BUDGET = 1024 * 1024;
+    constexpr qsizetype IMAGE_BYTES = 16 * 1024;
+
+    constexpr qint32 READER_THREADS = 4;
+    constexpr qint32 PUBLICATIONS = 5000;
+
+    auto prepareImage(qsizetype bytes) -> WordImage {
+        return WordImage {
+            .id = 1,
+            .url = QUrl("https://example.org/image.png"),
+            .width = 64,
+            .height = 64,
+            .data = QByteArray(bytes, 'x'),
+        };
+    }
+}
+
+class WordCacheTest final : public QObject {
+    Q_OBJECT
+private slots:
+    void testInsertStaysInBudget();
+    void testStoreImageStaysInBudget();
+    void testStoreImageDropsWordOverShardBudget();
+    void testFindByExactName();
+    void testConcurrentReadersSeeWholeWords();
+};
+
+void WordCacheTest::testInsertStaysInBudget() {
+    WordCache wordCache(BYTE_BUDGET);
+
+    for (Word& word : test::prepareWords(200)) {
+        word.image = prepareImage(IMAGE_BYTES);
+        wordCache.insert(word);
+    }
+
+    const WordCache::Stats stats = wordCache.stats();
+    QVERIFY(stats.bytes <= BYTE_BUDGET);
+    QVERIFY(stats.evictions > 0);
+}
+
+void WordCacheTest::testStoreImageStaysInBudget() {
+    WordCache wordCache(BYTE_BUDGET);
+    const QVector<Word> words = test::prepareWords(100);
+
+    for (const Word& word : words) {
+        wordCache.insert(word);
+    }
+
+    QCOMPARE(wordCache.stats().evictions, qint64(0));
+
+    for (const Word& word : words) {
+        wordCache.storeWordImage(word.name, prepareImage(IMAGE_BYTES));
+    }
+
+    const WordCache::Stats stats = wordCache.stats();
+    QVERIFY(stats.bytes <= BYTE_BUDGET);
+    QVERIFY(stats.evictions > 0);
+
+    /* The word charged last is the most recently used one in its shard */
+    const std::optional<Word> cachedWord = wordCache.find(words.last().name);
+    QVERIFY(cachedWord.has_value());
+    QCOMPARE(cachedWord->image.data.size(), IMAGE_BYTES);
+}
+
+void WordCacheTest::testStoreImageDropsWordOverShardBudget() {
+    WordCache wordCache(BYTE_BUDGET);
+    const Word word = test::prepareWord("Haus", WordType::Noun);
+
+    wordCache.insert(word);
+    wordCache.storeWordImage(word.name, prepareImage(BYTE_BUDGET));
+
+    QVERIFY(!wordCache.find(word.name).has_value());
+    QCOMPARE(wordCache.stats().bytes, qint64(0));
+}
+
+void WordCacheTest::testFindByExactName() {
+    WordCache wordCache(BYTE_BUDGET);
+
+    wordCache.insert(test::prepareWord("Maße", WordType::Noun));
+
+    QVERIFY(!wordCache.find("Masse").has_value());
+    QCOMPARE(wordCache.find("Maße")->name, QString("Maße"));
+
+    wordCache.insert(test::prepareWord("Masse", WordType::Noun));
+    wordCache.remove("Maße");
+
+    QVERIFY(!wordCache.find("Maße").has_value());
+    QCOMPARE(wordCache.find("Masse")->name, QString("Masse"));
+}
+
+/*
+ * Run it under ThreadSanitizer too: readers must only ever see a whole published word.
+ */
+void WordCacheTest::testConcurrentReadersSeeWholeWords() {
+    WordCache wordCache(BYTE_BUDGET);
+    const QVector<Word> words = test::prepareWords(64);
+
+    std::atomic<bool> writing = true;
+    std::atomic<qint64> reads = 0;
+    std::atomic<qint64> tornReads = 0;
+
+    std::vector<std::thread> readers;
+
+    for (qint32 i = 0; i < READER_THREADS; ++i) {
+        readers.emplace_back([&wordCache, &words, &writing, &reads, &tornReads]() {
+            while (writing.load(std::memory_order_acquire)) {
+                if (const std::shared_ptr<const Word> snapshot = wordCache.loadSnapshot(); snapshot != nullptr) {
+                    if (snapshot->transcription != "[" + snapshot->name + "]" ||
+                        (!snapshot->image.data.isEmpty() && snapshot->image.url.fileName() != snapshot->name)) {
+                        ++tornReads;
+                    }
+                }
+
+                const Word& word = words.at(reads++ % words.size());
+
+                if (const std::optional<Word> cachedWord = wordCache.find(word.name); cachedWord && cachedWord->name != word.name) {
+                    ++tornReads;
+                }
+            }
+        });
+    }
+
+    std::thread imageWriter([&wordCache, &words, &writing]() {
+        for (qint32 i = 0; writing.load(std::memory_order_acquire); ++i) {
+            const Word& word = words.at(i % words.size());
+            WordImage image = prepareImage(64);
+            image.url = QUrl("https://example.org/" + word.name);
+
+            wordCache.storeWordImage(word.name, image);
+        }
+    });
+
+    for (qint32 i = 0; i < PUBLICATIONS; ++i) {
+        const Word& word = words.at(i % words.size());
+
+        wordCache.storeWordContent(word);
+        wordCache.insert(word);
+
+        if (i % 7 == 0) {
+            wordCache.remove(words.at((i + 1) % words.size()).name);
+        }
+    }
+
+    writing.store(false, std::memory_order_release);
+    imageWriter.join();
+
+    for (std::thread& reader : readers) {
+        reader.join();
+    }
+
+    QVERIFY(reads.load() > 0);
+    QCOMPARE(tornReads.load(), qint64(0));
+    QVERIFY(wordCache.isValid());
+    QVERIFY(wordCache.stats().bytes <= BYTE_BUDGET);
+}
+
+QTEST_GUILESS_MAIN(WordCacheTest)
+#include "WordCacheTest.moc"
@@ -0,0 +1,69 @@
+/*
+ * Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+ * SPDX-License-Identifier: MIT
+ * Copyright (c) 2023-2025 https://github.com/klappdev
+ *
+ * Permission is hereby  granted, free of charge, to any  person obtaining a copy
+ * of this software and associated  documentation files (the "Software"), to deal
+ * in the Software  without restriction, including without  limitation the rights
+ * to  use, copy,  modify, merge,  publish, distribute,  sublicense, and/or  sell
+ * copies  of  the Software,  and  to  permit persons  to  whom  the Software  is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE  IS PROVIDED "AS  IS", WITHOUT WARRANTY  OF ANY KIND,  EXPRESS OR
+ * IMPLIED,  INCLUDING BUT  NOT  LIMITED TO  THE  WARRANTIES OF  MERCHANTABILITY,
+ * FITNESS FOR  A PARTICULAR PURPOSE AND  NONINFRINGEMENT. IN NO EVENT  SHALL THE
+ * AUTHORS  OR COPYRIGHT  HOLDERS  BE  LIABLE FOR  ANY  CLAIM,  DAMAGES OR  OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF  CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE  OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+#include <QTemporaryDir>
+
+#include "common/Word.hpp"
+
+namespace grunwald::test {
+
+    inline auto prepareWord(const QString& name, WordType type = WordType::Verb) -> Word {
+        return Word {
+            .name = name,
+            .transcription = "[" + name + "]",
+            .translation = "<p>translation of " + name + "</p>",
+            .association = "association of " + name,
+            .etymology = "<p>etymology of " + name + "</p>",
+            .description = "<p>description of " + name + "</p>",
+            .type = type,
+            .date = QDateTime(QDate(2025, 1, 1), QTime(12, 0)),
+        };
+    }
+
+    inline auto prepareWords(qsizetype count, const QString& prefix = "wort") -> QVector<Word> {
+        QVector<Word> words;
+        words.reserve(count);
+
+        for (qsizetype i = 0; i < count; ++i) {
+            words.push_back(prepareWord(QString("%1%2").arg(prefix).arg(i, 5, 10, QChar('0'))));
+        }
+
+        return words;
+    }
+
+    /*
+     * Database file in a directory removed together with the fixture.
+     */
+    class TemporaryDatabase final {
+    public:
+        auto fileName(const QString& name = "grunwald.sqlite") const -> QString {
+            return mDirectory.filePath(name);
+        }
+
+    private:
+        QTemporaryDir mDirectory;
+    };
+}
@@ -0,0 +1,203 @@
+/*
+ * Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+ * SPDX-License-Identifier: MIT
+ * Copyright (c) 2023-2025 https://github.com/klappdev
+ *
+ * Permission is hereby  granted, free of charge, to any  person obtaining a copy
+ * of this software and associated  documentation files (the "Software"), to deal
+ * in the Software  without restriction, including without  limitation the rights
+ * to  use, copy,  modify, merge,  publish, distribute,  sublicense, and/or  sell
+ * copies  of  the Software,  and  to  permit persons  to  whom  the Software  is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE  IS PROVIDED "AS  IS", WITHOUT WARRANTY  OF ANY KIND,  EXPRESS OR
+ * IMPLIED,  INCLUDING BUT  NOT  LIMITED TO  THE  WARRANTIES OF  MERCHANTABILITY,
+ * FITNESS FOR  A PARTICULAR PURPOSE AND  NONINFRINGEMENT. IN NO EVENT  SHALL THE
+ * AUTHORS  OR COPYRIGHT  HOLDERS  BE  LIABLE FOR  ANY  CLAIM,  DAMAGES OR  OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF  CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE  OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <QtConcurrent>
+#include <QtTest>
+
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <numeric>
+#include <vector>
+
+#include "common/WordFixtures.hpp"
+#include "db/WordDao.hpp"
+
+using namespace grunwald;
+
+namespace {
+    constexpr qsizetype WORD_COUNT = 64;
+    constexpr qsizetype READS_PER_RUN = 256;
+
+    /*
+     * Long enough for a reader thread to block on a full pool.
+     */
+    constexpr qint32 BLOCKED_WAIT_MS = 200;
+}
+
+class WordConnectionPoolTest final : public QObject {
+    Q_OBJECT
+private slots:
+    void init();
+    void cleanup();
+
+    void testOwnerThreadUsesWriterConnection();
+    void testReadWithoutLeaseFails();
+    void testConcurrentReads();
+    void testNestedLeasesShareConnection();
+    void testThreadWaitsForFinishedThread();
+
+    void benchmarkConcurrentReads_data();
+    void benchmarkConcurrentReads();
+
+private:
+    auto runReads(qint32 threadCount, qsizetype readCount) -> qsizetype;
+
+    std::unique_ptr<test::TemporaryDatabase> mDatabase;
+    std::unique_ptr<WordDao> mWordDao;
+    QVector<Word> mWords;
+    QThreadPool mReaderPool;
+};
+
+void WordConnectionPoolTest::init() {
+    mDatabase = std::make_unique<test::TemporaryDatabase>();
+    mWordDao = std::make_unique<WordDao>(mDatabase->fileName(), WordDao::JournalMode::Wal, WordDao::TextEncoding::Compressed);
+    mWords = test::prepareWords(WORD_COUNT);
+
+    for (const Result<void, DbError>& result : mWordDao->addBatch(QSpan<const Word>(mWords))) {
+        QVERIFY(!result.hasError());
+    }
+}
+
+void WordConnectionPoolTest::cleanup() {
+    /* Reader threads close their connections before the pool goes away */
+    mReaderPool.waitForDone();
+    mWordDao.reset();
+    mDatabase.reset();
+}
+
+auto WordConnectionPoolTest::runReads(qint32 threadCount, qsizetype readCount) -> qsizetype {
+    QThreadPool threadPool;
+    threadPool.setMaxThreadCount(threadCount);
+
+    QVector<qsizetype> indexes(readCount);
+    std::iota(indexes.begin(), indexes.end(), 0);
+
+    const QVector<bool> results = QtConcurrent::blockingMapped(&threadPool, indexes, [this](qsizetype index) {
+        const WordConnectionPool::Lease lease = mWordDao->leaseConnection();
+        const QString& name = mWords.at(index % mWords.size()).name;
+        const Result<QVector<Word>, DbError> result = mWordDao->search(name);
+
+        return lease.isValid() && result.hasValue() && result.value().size() == 1 && result.value().at(0).name == name;
+    });
+
+    return std::count(results.cbegin(), results.cend(), true);
+}
+
+void WordConnectionPoolTest::testOwnerThreadUsesWriterConnection() {
+    const WordConnectionPool::Lease lease = mWordDao->leaseConnection();
+    QVERIFY(!lease.isValid());
+
+    const Result<QVector<Word>, DbError> result = mWordDao->search(mWords.at(0).name);
+    QVERIFY(result.hasValue());
+    QCOMPARE(result.value().size(), 1);
+}
+
+void WordConnectionPoolTest::testReadWithoutLeaseFails() {
+    QFuture<bool> future = QtConcurrent::run(&mReaderPool, [this]() {
+        return mWordDao->search(mWords.at(0).name).hasError();
+    });
+
+    QVERIFY(future.result());
+}
+
+void WordConnectionPoolTest::testConcurrentReads() {
+    QCOMPARE(runReads(WordDao::READER_CONNECTIONS, READS_PER_RUN), READS_PER_RUN);
+
+    /* Threads of the first run finished and closed their connections */
+    QCOMPARE(runReads(WordDao::READER_CONNECTIONS, READS_PER_RUN), READS_PER_RUN);
+}
+
+void WordConnectionPoolTest::testNestedLeasesShareConnection() {
+    QFuture<bool> future = QtConcurrent::run(&mReaderPool, [this]() {
+        const WordConnectionPool::Lease outerLease = mWordDao->leaseConnection();
+        const WordConnectionPool::Lease innerLease = mWordDao->leaseConnection();
+
+        return outerLease.isValid() && innerLease.isValid() && mWordDao->search(mWords.at(1).name).hasValue();
+    });
+
+    QVERIFY(future.result());
+}
+
+/*
+ * Connections are pinned to their threads: a thread beyond the pool size
+ * gets one only after a thread holding a connection finishes.
+ */
+void WordConnectionPoolTest::testThreadWaitsForFinishedThread() {
+    QSemaphore leased;
+    QSemaphore finish;
+    std::vector<std::unique_ptr<QThread>> holders;
+
+    for (qint32 i = 0; i < WordDao::READER_CONNECTIONS; ++i) {
+        holders.emplace_back(QThread::create([this, &leased, &finish]() {
+            {
+                const WordConnectionPool::Lease lease = mWordDao->leaseConnection();
+                leased.release();
+            }
+
+            finish.acquire();
+        }));
+        holders.back()->start();
+    }
+
+    QVERIFY(leased.tryAcquire(WordDao::READER_CONNECTIONS, WordConnectionPool::ACQUIRE_TIMEOUT_MS));
+
+    std::atomic<bool> extraRead = false;
+    const std::unique_ptr<QThread> extra(QThread::create([this, &extraRead]() {
+        const WordConnectionPool::Lease lease = mWordDao->leaseConnection();
+        extraRead = lease.isValid() && mWordDao->search(mWords.at(2).name).hasValue();
+    }));
+    extra->start();
+
+    QVERIFY(!extra->wait(BLOCKED_WAIT_MS));
+
+    finish.release();
+    QVERIFY(extra->wait(WordConnectionPool::ACQUIRE_TIMEOUT_MS));
+    QVERIFY(extraRead);
+
+    finish.release(WordDao::READER_CONNECTIONS - 1);
+
+    for (const std::unique_ptr<QThread>& holder : holders) {
+        QVERIFY(holder->wait(WordConnectionPool::ACQUIRE_TIMEOUT_MS));
+    }
+}
+
+void WordConnectionPoolTest::benchmarkConcurrentReads_data() {
+    QTest::addColumn<qint32>("threadCount");
+
+    for (qint32 threadCount : { 1, 2, WordDao::READER_CONNECTIONS }) {
+        QTest::addRow("%d threads", threadCount) << threadCount;
+    }
+}
+
+void WordConnectionPoolTest::benchmarkConcurrentReads() {
+    QFETCH(qint32, threadCount);
+
+    QBENCHMARK {
+        QCOMPARE(runReads(threadCount, READS_PER_RUN), READS_PER_RUN);
+    }
+}
+
+QTEST_GUILESS_MAIN(WordConnectionPoolTest)
+#include "WordConnectionPoolTest.moc"
@@ -0,0 +1,172 @@
+/*
+ * Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+ * SPDX-License-Identifier: MIT
+ * Copyright (c) 2023-2025 https://github.com/klappdev
+ *
+ * Permission is hereby  granted, free of charge, to any  person obtaining a copy
+ * of this software and associated  documentation files (the "Software"), to deal
+ * in the Software  without restriction, including without  limitation the rights
+ * to  use, copy,  modify, merge,  publish, distribute,  sublicense, and/or  sell
+ * copies  of  the Software,  and  to  permit persons  to  whom  the Software  is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE  IS PROVIDED "AS  IS", WITHOUT WARRANTY  OF ANY KIND,  EXPRESS OR
+ * IMPLIED,  INCLUDING BUT  NOT  LIMITED TO  THE  WARRANTIES OF  MERCHANTABILITY,
+ * FITNESS FOR  A PARTICULAR PURPOSE AND  NONINFRINGEMENT. IN NO EVENT  SHALL THE
+ * AUTHORS  OR COPYRIGHT  HOLDERS  BE  LIABLE FOR  ANY  CLAIM,  DAMAGES OR  OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF  CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE  OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <QtTest>
+
+#include "common/WordFixtures.hpp"
+#include "db/WordDao.hpp"
+
+using namespace grunwald;
+
+namespace {
+    constexpr const char* const LARGE_BENCHMARKS_VARIABLE = "GRUNWALD_LARGE_BENCHMARKS";
+}
+
+class WordDaoBatchTest final : public QObject {
+    Q_OBJECT
+private slots:
+    void init();
+    void cleanup();
+
+    void testAddBatchReturnsResultPerRow();
+    void testAddBatchUpsertsSavedWords();
+    void testUpdateBatch();
+    void testApplyBatch();
+
+    void benchmarkAdd_data();
+    void benchmarkAdd();
+
+private:
+    std::unique_ptr<test::TemporaryDatabase> mDatabase;
+    std::unique_ptr<WordDao> mWordDao;
+};
+
+void WordDaoBatchTest::init() {
+    mDatabase = std::make_unique<test::TemporaryDatabase>();
+    mWordDao = std::make_unique<WordDao>(mDatabase->fileName(), WordDao::JournalMode::Wal, WordDao::TextEncoding::Compressed);
+}
+
+void WordDaoBatchTest::cleanup() {
+    mWordDao.reset();
+    mDatabase.reset();
+}
+
+void WordDaoBatchTest::testAddBatchReturnsResultPerRow() {
+    const QVector<Word> words = test::prepareWords(100);
+    const QVector<Result<void, DbError>> results = mWordDao->addBatch(QSpan<const Word>(words));
+
+    QCOMPARE(results.size(), words.size());
+
+    for (const Result<void, DbError>& result : results) {
+        QVERIFY(!result.hasError());
+    }
+
+    const Result<QStringList, DbError> names = mWordDao->getNames();
+    QVERIFY(names.hasValue());
+    QCOMPARE(names.value().size(), words.size());
+}
+
+void WordDaoBatchTest::testAddBatchUpsertsSavedWords() {
+    QVector<Word> words = test::prepareWords(10);
+    QVERIFY(!mWordDao->addBatch(QSpan<const Word>(words)).at(0).hasError());
+
+    words[3].translation = "<p>changed</p>";
+    QVERIFY(!mWordDao->addBatch(QSpan<const Word>(words)).at(3).hasError());
+
+    const Result<QVector<Word>, DbError> found = mWordDao->search(words.at(3).name);
+    QVERIFY(found.hasValue());
+    QCOMPARE(found.value().size(), 1);
+    QCOMPARE(found.value().at(0).translation, QString("<p>changed</p>"));
+}
+
+void WordDaoBatchTest::testUpdateBatch() {
+    const QVector<Word> words = test::prepareWords(10);
+    QVERIFY(!mWordDao->addBatch(QSpan<const Word>(words)).at(0).hasError());
+
+    const Result<QVector<Word>, DbError> saved = mWordDao->getAll();
+    QVERIFY(saved.hasValue());
+
+    QVector<Word> changedWords = saved.value();
+
+    for (Word& word : changedWords) {
+        word.association = "changed " + word.name;
+    }
+
+    for (const Result<void, DbError>& result : mWordDao->updateBatch(QSpan<const Word>(changedWords))) {
+        QVERIFY(!result.hasError());
+    }
+
+    const Result<QVector<Word>, DbError> updated = mWordDao->search(words.at(5).name);
+    QVERIFY(updated.hasValue());
+    QCOMPARE(updated.value().at(0).association, "changed " + words.at(5).name);
+}
+
+void WordDaoBatchTest::testApplyBatch() {
+    const QVector<Word> words = test::prepareWords(3);
+    const QVector<WordChange> changes = {
+        WordChange { WordChange::Type::Add, words.at(0) },
+        WordChange { WordChange::Type::Add, words.at(1) },
+        WordChange { WordChange::Type::Remove, words.at(0) },
+        WordChange { WordChange::Type::Add, words.at(2) },
+    };
+
+    for (const Result<void, DbError>& result : mWordDao->applyBatch(QSpan<const WordChange>(changes))) {
+        QVERIFY(!result.hasError());
+    }
+
+    QVERIFY(!mWordDao->checkIfExists(words.at(0).name));
+    QVERIFY(mWordDao->checkIfExists(words.at(1).name));
+    QVERIFY(mWordDao->checkIfExists(words.at(2).name));
+}
+
+void WordDaoBatchTest::benchmarkAdd_data() {
+    QTest::addColumn<qsizetype>("wordCount");
+    QTest::addColumn<bool>("batched");
+
+    for (qsizetype wordCount : { 10'000, 100'000 }) {
+        QTest::addRow("add %lld", static_cast<long long>(wordCount)) << wordCount << false;
+        QTest::addRow("addBatch %lld", static_cast<long long>(wordCount)) << wordCount << true;
+    }
+}
+
+void WordDaoBatchTest::benchmarkAdd() {
+    QFETCH(qsizetype, wordCount);
+    QFETCH(bool, batched);
+
+    if (wordCount > 10'000 && !qEnvironmentVariableIsSet(LARGE_BENCHMARKS_VARIABLE)) {
+        QSKIP("Set GRUNWALD_LARGE_BENCHMARKS to run with 100k words");
+    }
+
+    const QVector<Word> words = test::prepareWords(wordCount);
+
+    QElapsedTimer timer;
+    timer.start();
+
+    QBENCHMARK_ONCE {
+        if (batched) {
+            QVERIFY(!mWordDao->addBatch(QSpan<const Word>(words)).constLast().hasError());
+        } else {
+            for (const Word& word : words) {
+                QVERIFY(!mWordDao->add(word).hasError());
+            }
+        }
+    }
+
+    const qint64 elapsedMs = qMax<qint64>(timer.elapsed(), 1);
+
+    qInfo() << (batched ? "addBatch" : "add") << wordCount << "words:" << wordCount * 1000 / elapsedMs << "rows/s";
+}
+
+QTEST_GUILESS_MAIN(WordDaoBatchTest)
+#include "WordDaoBatchTest.moc"
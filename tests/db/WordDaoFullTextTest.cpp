@@ -0,0 +1,137 @@
+/*
+ * Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+ * SPDX-License-Identifier: MIT
+ * Copyright (c) 2023-2025 https://github.com/klappdev
+ *
+ * Permission is hereby  granted, free of charge, to any  person obtaining a copy
+ * of this software and associated  documentation files (the "Software"), to deal
+ * in the Software  without restriction, including without  limitation the rights
+ * to  use, copy,  modify, merge,  publish, distribute,  sublicense, and/or  sell
+ * copies  of  the Software,  and  to  permit persons  to  whom  the Software  is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE  IS PROVIDED "AS  IS", WITHOUT WARRANTY  OF ANY KIND,  EXPRESS OR
+ * IMPLIED,  INCLUDING BUT  NOT  LIMITED TO  THE  WARRANTIES OF  MERCHANTABILITY,
+ * FITNESS FOR  A PARTICULAR PURPOSE AND  NONINFRINGEMENT. IN NO EVENT  SHALL THE
+ * AUTHORS  OR COPYRIGHT  HOLDERS  BE  LIABLE FOR  ANY  CLAIM,  DAMAGES OR  OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF  CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE  OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include <QtTest>
+
+#include "common/WordFixtures.hpp"
+#include "db/WordDao.hpp"
+
+using namespace grunwald;
+
+class WordDaoFullTextTest final : public QObject {
+    Q_OBJECT
+private slots:
+    void initTestCase_data();
+    void init();
+    void cleanup();
+
+    void testInsertIsIndexed();
+    void testUpdateReplacesIndexedText();
+    void testRemoveDropsIndexedText();
+    void testReopenKeepsIndex();
+
+private:
+    auto fullTextNames(const QString& text) -> QStringList;
+
+    std::unique_ptr<test::TemporaryDatabase> mDatabase;
+    std::unique_ptr<WordDao> mWordDao;
+};
+
+void WordDaoFullTextTest::initTestCase_data() {
+    QTest::addColumn<WordDao::TextEncoding>("textEncoding");
+
+    QTest::addRow("plain") << WordDao::TextEncoding::Plain;
+    QTest::addRow("compressed") << WordDao::TextEncoding::Compressed;
+}
+
+void WordDaoFullTextTest::init() {
+    QFETCH_GLOBAL(WordDao::TextEncoding, textEncoding);
+
+    mDatabase = std::make_unique<test::TemporaryDatabase>();
+    mWordDao = std::make_unique<WordDao>(mDatabase->fileName(), WordDao::JournalMode::Wal, textEncoding);
+
+    Word word = test::prepareWord("Haus", WordType::Noun);
+    word.translation = "<p>house, home</p>";
+
+    QVERIFY(!mWordDao->add(word).hasError());
+    QVERIFY(!mWordDao->add(test::prepareWord("laufen")).hasError());
+}
+
+void WordDaoFullTextTest::cleanup() {
+    mWordDao.reset();
+    mDatabase.reset();
+}
+
+auto WordDaoFullTextTest::fullTextNames(const QString& text) -> QStringList {
+    QStringList names;
+    const Result<QVector<Word>, DbError> result = mWordDao->fullTextSearch(text, 10);
+
+    if (result.hasValue()) {
+        for (const Word& word : result.value()) {
+            names.push_back(word.name);
+        }
+    }
+
+    return names;
+}
+
+void WordDaoFullTextTest::testInsertIsIndexed() {
+    QCOMPARE(fullTextNames("house"), QStringList { "Haus" });
+    QCOMPARE(fullTextNames("hom"), QStringList { "Haus" });
+    QCOMPARE(fullTextNames("Haus"), QStringList { "Haus" });
+    QCOMPARE(fullTextNames("laufen"), QStringList { "laufen" });
+}
+
+void WordDaoFullTextTest::testUpdateReplacesIndexedText() {
+    const Result<QVector<Word>, DbError> found = mWordDao->search("Haus");
+    QVERIFY(found.hasValue());
+    QCOMPARE(found.value().size(), 1);
+
+    Word word = found.value().at(0);
+    word.translation = "<p>building</p>";
+    QVERIFY(!mWordDao->update(word).hasError());
+
+    QVERIFY(fullTextNames("house").isEmpty());
+    QCOMPARE(fullTextNames("building"), QStringList { "Haus" });
+
+    /* Saving a word by name again goes through the update trigger too */
+    word.translation = "<p>cottage</p>";
+    QVERIFY(!mWordDao->add(word).hasError());
+
+    QVERIFY(fullTextNames("building").isEmpty());
+    QCOMPARE(fullTextNames("cottage"), QStringList { "Haus" });
+}
+
+void WordDaoFullTextTest::testRemoveDropsIndexedText() {
+    const Result<QVector<Word>, DbError> found = mWordDao->search("Haus");
+    QVERIFY(found.hasValue());
+    QCOMPARE(found.value().size(), 1);
+
+    QVERIFY(!mWordDao->remove(found.value().at(0)).hasError());
+
+    QVERIFY(fullTextNames("house").isEmpty());
+    QVERIFY(fullTextNames("Haus").isEmpty());
+    QCOMPARE(fullTextNames("laufen"), QStringList { "laufen" });
+}
+
+void WordDaoFullTextTest::testReopenKeepsIndex() {
+    QFETCH_GLOBAL(WordDao::TextEncoding, textEncoding);
+
+    mWordDao.reset();
+    mWordDao = std::make_unique<WordDao>(mDatabase->fileName(), WordDao::JournalMode::Wal, textEncoding);
+
+    QCOMPARE(fullTextNames("house"), QStringList { "Haus" });
+}
+
+QTEST_GUILESS_MAIN(WordDaoFullTextTest)
+#include "WordDaoFullTextTest.moc"
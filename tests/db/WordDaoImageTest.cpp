@@ -0,0 +1,193 @@
+/*
+ * Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+ * SPDX-License-Identifier: MIT
+ * Copyright (c) 2023-2025 https://github.com/klappdev
+ *
+ * Permission is hereby  granted, free of charge, to any  person obtaining a copy
+ * of this software and associated  documentation files (the "Software"), to deal
+ * in the Software  without restriction, including without  limitation the rights
+ * to  use, copy,  modify, merge,  publish, distribute,  sublicense, and/or  sell
+ * copies  of  the Software,  and  to  permit persons  to  whom  the Software  is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE  IS PROVIDED "AS  IS", WITHOUT WARRANTY  OF ANY KIND,  EXPRESS OR
+ * IMPLIED,  INCLUDING BUT  NOT  LIMITED TO  THE  WARRANTIES OF  MERCHANTABILITY,
+ * FITNESS FOR  A PARTICULAR PURPOSE AND  NONINFRINGEMENT. IN NO EVENT  SHALL THE
+ * AUTHORS  OR COPYRIGHT  HOLDERS  BE  LIABLE FOR  ANY  CLAIM,  DAMAGES OR  OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF  CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE  OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <QtTest>
+
+#include "common/WordFixtures.hpp"
+#include "db/WordDao.hpp"
+
+using namespace grunwald;
+
+namespace {
+    constexpr qsizetype IMAGE_SIZE = 64 * 1024;
+    constexpr qsizetype BENCHMARK_WORD_COUNT = 500;
+
+    auto prepareNoun(qsizetype index) -> Word {
+        Word word = test::prepareWord(QString("Nomen%1").arg(index, 5, 10, QChar('0')), WordType::Noun);
+
+        QByteArray data(IMAGE_SIZE, static_cast<char>(index % 251));
+        data.replace(0, sizeof(index), reinterpret_cast<const char*>(&index), sizeof(index));
+
+        word.image = WordImage {
+            .url = QUrl(QString("https://upload.wikimedia.org/%1.png").arg(index)),
+            .width = 320,
+            .height = 240,
+            .data = data,
+        };
+
+        return word;
+    }
+}
+
+class WordDaoImageTest final : public QObject {
+    Q_OBJECT
+private slots:
+    void init();
+    void cleanup();
+
+    void testListQueriesSkipImageData();
+    void testLoadImageData();
+    void testGetLoadsImageData();
+    void testImageStreamMatchesImageData();
+
+    void benchmarkStartupLoad();
+
+private:
+    void addNouns(qsizetype count);
+
+    std::unique_ptr<test::TemporaryDatabase> mDatabase;
+    std::unique_ptr<WordDao> mWordDao;
+};
+
+void WordDaoImageTest::init() {
+    mDatabase = std::make_unique<test::TemporaryDatabase>();
+    mWordDao = std::make_unique<WordDao>(mDatabase->fileName(), WordDao::JournalMode::Wal, WordDao::TextEncoding::Compressed);
+}
+
+void WordDaoImageTest::cleanup() {
+    mWordDao.reset();
+    mDatabase.reset();
+}
+
+void WordDaoImageTest::addNouns(qsizetype count) {
+    QVector<Word> words;
+
+    for (qsizetype i = 0; i < count; ++i) {
+        words.push_back(prepareNoun(i));
+    }
+
+    for (const Result<void, DbError>& result : mWordDao->addBatch(QSpan<const Word>(words))) {
+        QVERIFY(!result.hasError());
+    }
+}
+
+void WordDaoImageTest::testListQueriesSkipImageData() {
+    addNouns(3);
+
+    const Result<QVector<Word>, DbError> all = mWordDao->getAll();
+    const Result<QVector<Word>, DbError> page = mWordDao->page(QString{}, 0, 10);
+    const Result<QVector<Word>, DbError> found = mWordDao->search(prepareNoun(1).name);
+
+    QVERIFY(all.hasValue() && page.hasValue() && found.hasValue());
+    QCOMPARE(all.value().size(), 3);
+    QCOMPARE(page.value().size(), 3);
+    QCOMPARE(found.value().size(), 1);
+
+    for (const QVector<Word>& words : { all.value(), page.value(), found.value() }) {
+        for (const Word& word : words) {
+            QVERIFY(word.image.id > 0);
+            QCOMPARE(word.image.width, 320);
+            QCOMPARE(word.image.height, 240);
+            QVERIFY(word.image.data.isEmpty());
+        }
+    }
+}
+
+void WordDaoImageTest::testLoadImageData() {
+    addNouns(2);
+
+    const Result<QVector<Word>, DbError> found = mWordDao->search(prepareNoun(1).name);
+    QVERIFY(found.hasValue());
+
+    const Result<QByteArray, DbError> imageData = mWordDao->loadImageData(found.value().at(0).image.id);
+    QVERIFY(imageData.hasValue());
+    QCOMPARE(imageData.value(), prepareNoun(1).image.data);
+}
+
+void WordDaoImageTest::testGetLoadsImageData() {
+    addNouns(1);
+
+    const Result<QVector<Word>, DbError> found = mWordDao->search(prepareNoun(0).name);
+    QVERIFY(found.hasValue());
+
+    const Result<Word, DbError> word = mWordDao->get(static_cast<qint32>(found.value().at(0).id));
+    QVERIFY(word.hasValue());
+    QCOMPARE(word.value().image.data, prepareNoun(0).image.data);
+}
+
+void WordDaoImageTest::testImageStreamMatchesImageData() {
+    addNouns(1);
+
+    const Result<QVector<Word>, DbError> found = mWordDao->search(prepareNoun(0).name);
+    QVERIFY(found.hasValue());
+
+    /*
+     * Blob stream or buffer, depending on whether Qt shares the linked SQLite.
+     */
+    Result<std::unique_ptr<QIODevice>, DbError> stream = mWordDao->openImageStream(found.value().at(0).image.id);
+    QVERIFY(stream.hasValue());
+
+    QIODevice* device = stream.value().get();
+    QCOMPARE(device->size(), IMAGE_SIZE);
+
+    QByteArray streamedData;
+
+    while (!device->atEnd()) {
+        const QByteArray chunk = device->read(4096);
+        QVERIFY(!chunk.isEmpty());
+        streamedData += chunk;
+    }
+
+    QCOMPARE(streamedData, prepareNoun(0).image.data);
+}
+
+void WordDaoImageTest::benchmarkStartupLoad() {
+    addNouns(BENCHMARK_WORD_COUNT);
+
+    qsizetype loadedImageBytes = 0;
+
+    QBENCHMARK {
+        const Result<QVector<Word>, DbError> words = mWordDao->getAll();
+        QVERIFY(words.hasValue());
+
+        loadedImageBytes = 0;
+
+        for (const Word& word : words.value()) {
+            loadedImageBytes += word.image.data.size();
+        }
+    }
+
+    /*
+     * Before lazy loading every listed word carried its image bytes.
+     */
+    const qsizetype storedImageBytes = BENCHMARK_WORD_COUNT * IMAGE_SIZE;
+
+    qInfo() << "getAll of" << BENCHMARK_WORD_COUNT << "nouns holds" << loadedImageBytes << "image bytes, eager loading held"
+            << storedImageBytes << "bytes";
+
+    QCOMPARE(loadedImageBytes, 0);
+}
+
+QTEST_GUILESS_MAIN(WordDaoImageTest)
+#include "WordDaoImageTest.moc"
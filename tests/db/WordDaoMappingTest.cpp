@@ -0,0 +1,194 @@
+/*
+ * Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+ * SPDX-License-Identifier: MIT
+ * Copyright (c) 2023-2025 https://github.com/klappdev
+ *
+ * Permission is hereby  granted, free of charge, to any  person obtaining a copy
+ * of this software and associated  documentation files (the "Software"), to deal
+ * in the Software  without restriction, including without  limitation the rights
+ * to  use, copy,  modify, merge,  publish, distribute,  sublicense, and/or  sell
+ * copies  of  the Software,  and  to  permit persons  to  whom  the Software  is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE  IS PROVIDED "AS  IS", WITHOUT WARRANTY  OF ANY KIND,  EXPRESS OR
+ * IMPLIED,  INCLUDING BUT  NOT  LIMITED TO  THE  WARRANTIES OF  MERCHANTABILITY,
+ * FITNESS FOR  A PARTICULAR PURPOSE AND  NONINFRINGEMENT. IN NO EVENT  SHALL THE
+ * AUTHORS  OR COPYRIGHT  HOLDERS  BE  LIABLE FOR  ANY  CLAIM,  DAMAGES OR  OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF  CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE  OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <QtTest>
+
+#include "common/WordFixtures.hpp"
+#include "db/WordDao.hpp"
+
+using namespace grunwald;
+
+namespace {
+    constexpr qsizetype BENCHMARK_WORD_COUNT = 10'000;
+    constexpr const char* const DECODE_CONNECTION = "grunwald_decode_benchmark";
+
+    const QStringList WORD_COLUMNS = {
+        "id", "name", "transcription", "translation", "association", "etymology", "description", "type", "date"
+    };
+}
+
+class WordDaoMappingTest final : public QObject {
+    Q_OBJECT
+private slots:
+    void init();
+    void cleanup();
+
+    void testEveryFieldRoundTrips();
+    void testPlainAndCompressedRowsMix();
+
+    void benchmarkGetAll();
+    void benchmarkRowDecode_data();
+    void benchmarkRowDecode();
+
+private:
+    std::unique_ptr<test::TemporaryDatabase> mDatabase;
+    std::unique_ptr<WordDao> mWordDao;
+};
+
+void WordDaoMappingTest::init() {
+    mDatabase = std::make_unique<test::TemporaryDatabase>();
+    mWordDao = std::make_unique<WordDao>(mDatabase->fileName(), WordDao::JournalMode::Wal, WordDao::TextEncoding::Compressed);
+}
+
+void WordDaoMappingTest::cleanup() {
+    mWordDao.reset();
+    mDatabase.reset();
+}
+
+void WordDaoMappingTest::testEveryFieldRoundTrips() {
+    Word word = test::prepareWord("Straße", WordType::Noun);
+    word.image = WordImage {
+        .url = QUrl("https://upload.wikimedia.org/strasse.png"),
+        .width = 640,
+        .height = 480,
+        .data = QByteArray("image bytes"),
+    };
+
+    QVERIFY(!mWordDao->add(word).hasError());
+
+    const Result<QVector<Word>, DbError> found = mWordDao->search(word.name);
+    QVERIFY(found.hasValue());
+    QCOMPARE(found.value().size(), 1);
+
+    const Word& savedWord = found.value().at(0);
+    QVERIFY(savedWord.id > 0);
+    QCOMPARE(savedWord.name, word.name);
+    QCOMPARE(savedWord.transcription, word.transcription);
+    QCOMPARE(savedWord.translation, word.translation);
+    QCOMPARE(savedWord.association, word.association);
+    QCOMPARE(savedWord.etymology, word.etymology);
+    QCOMPARE(savedWord.description, word.description);
+    QCOMPARE(savedWord.type, word.type);
+    QCOMPARE(savedWord.date, word.date);
+    QVERIFY(savedWord.image.id > 0);
+    QCOMPARE(savedWord.image.url, word.image.url);
+    QCOMPARE(savedWord.image.width, word.image.width);
+    QCOMPARE(savedWord.image.height, word.image.height);
+
+    const Result<Word, DbError> loadedWord = mWordDao->get(static_cast<qint32>(savedWord.id));
+    QVERIFY(loadedWord.hasValue());
+    QCOMPARE(loadedWord.value().image.data, word.image.data);
+}
+
+void WordDaoMappingTest::testPlainAndCompressedRowsMix() {
+    const Word compressedWord = test::prepareWord("gehen");
+    QVERIFY(!mWordDao->add(compressedWord).hasError());
+
+    mWordDao.reset();
+    mWordDao = std::make_unique<WordDao>(mDatabase->fileName(), WordDao::JournalMode::Wal, WordDao::TextEncoding::Plain);
+
+    const Word plainWord = test::prepareWord("geben");
+    QVERIFY(!mWordDao->add(plainWord).hasError());
+
+    for (const Word& word : { compressedWord, plainWord }) {
+        const Result<QVector<Word>, DbError> found = mWordDao->search(word.name);
+        QVERIFY(found.hasValue());
+        QCOMPARE(found.value().at(0).description, word.description);
+    }
+}
+
+void WordDaoMappingTest::benchmarkGetAll() {
+    const QVector<Word> words = test::prepareWords(BENCHMARK_WORD_COUNT);
+    QVERIFY(!mWordDao->addBatch(QSpan<const Word>(words)).constLast().hasError());
+
+    QElapsedTimer timer;
+    qint64 elapsedNs = 0;
+    qint64 runs = 0;
+
+    QBENCHMARK {
+        timer.start();
+
+        const Result<QVector<Word>, DbError> savedWords = mWordDao->getAll();
+        QVERIFY(savedWords.hasValue());
+        QCOMPARE(savedWords.value().size(), words.size());
+
+        elapsedNs += timer.nsecsElapsed();
+        ++runs;
+    }
+
+    qInfo() << "getAll decodes" << BENCHMARK_WORD_COUNT * runs * 1'000'000'000 / qMax<qint64>(elapsedNs, 1) << "rows/s";
+}
+
+void WordDaoMappingTest::benchmarkRowDecode_data() {
+    QTest::addColumn<bool>("byIndex");
+
+    QTest::addRow("column name") << false;
+    QTest::addRow("column index") << true;
+}
+
+/*
+ * Column lookup alone, on plain text rows: by name as prepareWord did
+ * before, and by position as WordColumn does now.
+ */
+void WordDaoMappingTest::benchmarkRowDecode() {
+    QFETCH(bool, byIndex);
+
+    mWordDao.reset();
+    mWordDao = std::make_unique<WordDao>(mDatabase->fileName(), WordDao::JournalMode::Wal, WordDao::TextEncoding::Plain);
+
+    const QVector<Word> words = test::prepareWords(BENCHMARK_WORD_COUNT);
+    QVERIFY(!mWordDao->addBatch(QSpan<const Word>(words)).constLast().hasError());
+
+    {
+        QSqlDatabase database = QSqlDatabase::addDatabase("QSQLITE", DECODE_CONNECTION);
+        database.setDatabaseName(mDatabase->fileName());
+        QVERIFY(database.open());
+
+        QSqlQuery query(database);
+        query.setForwardOnly(true);
+
+        qsizetype decodedLength = 0;
+
+        QBENCHMARK {
+            QVERIFY(query.exec("SELECT " + WORD_COLUMNS.join(", ") + " FROM word"));
+
+            const QSqlRecord record = query.record();
+
+            while (query.next()) {
+                for (qsizetype column = 0; column < WORD_COLUMNS.size(); ++column) {
+                    const int index = byIndex ? static_cast<int>(column) : record.indexOf(WORD_COLUMNS.at(column));
+                    decodedLength += query.value(index).toString().size();
+                }
+            }
+        }
+
+        QVERIFY(decodedLength > 0);
+        database.close();
+    }
+
+    QSqlDatabase::removeDatabase(DECODE_CONNECTION);
+}
+
+QTEST_GUILESS_MAIN(WordDaoMappingTest)
+#include "WordDaoMappingTest.moc"
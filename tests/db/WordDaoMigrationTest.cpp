@@ -0,0 +1,239 @@
+/*
+ * Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+ * SPDX-License-Identifier: MIT
+ * Copyright (c) 2023-2025 https://github.com/klappdev
+ *
+ * Permission is hereby  granted, free of charge, to any  person obtaining a copy
+ * of this software and associated  documentation files (the "Software"), to deal
+ * in the Software  without restriction, including without  limitation the rights
+ * to  use, copy,  modify, merge,  publish, distribute,  sublicense, and/or  sell
+ * copies  of  the Software,  and  to  permit persons  to  whom  the Software  is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE  IS PROVIDED "AS  IS", WITHOUT WARRANTY  OF ANY KIND,  EXPRESS OR
+ * IMPLIED,  INCLUDING BUT  NOT  LIMITED TO  THE  WARRANTIES OF  MERCHANTABILITY,
+ * FITNESS FOR  A PARTICULAR PURPOSE AND  NONINFRINGEMENT. IN NO EVENT  SHALL THE
+ * AUTHORS  OR COPYRIGHT  HOLDERS  BE  LIABLE FOR  ANY  CLAIM,  DAMAGES OR  OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF  CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE  OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <QtTest>
+
+#include "common/WordFixtures.hpp"
+#include "db/WordDao.hpp"
+
+using namespace grunwald;
+
+namespace {
+    constexpr const char* const LEGACY_CONNECTION = "grunwald_legacy_connection";
+}
+
+class WordDaoMigrationTest final : public QObject {
+    Q_OBJECT
+private slots:
+    void init();
+    void cleanup();
+
+    void testMigrationKeepsWordsSharingKey();
+    void testMigrationKeepsWordsSavedTwice();
+    void testAddKeepsWordsSharingKey();
+    void testMissesAreKeptPerName();
+    void testReadOnlyOpenSkipsMigration();
+    void testReadOnlyOpenDoesNotCreateDatabase();
+
+private:
+    void createLegacyDatabase(const QStringList& names);
+    auto openWordDao() -> std::unique_ptr<WordDao>;
+    static auto names(const QVector<Word>& words) -> QStringList;
+
+    std::unique_ptr<test::TemporaryDatabase> mDatabase;
+};
+
+void WordDaoMigrationTest::init() {
+    mDatabase = std::make_unique<test::TemporaryDatabase>();
+}
+
+void WordDaoMigrationTest::cleanup() {
+    mDatabase.reset();
+}
+
+/*
+ * Schema 0: no keys, no indexes, the same headword may be saved twice.
+ */
+void WordDaoMigrationTest::createLegacyDatabase(const QStringList& names) {
+    {
+        QSqlDatabase database = QSqlDatabase::addDatabase("QSQLITE", LEGACY_CONNECTION);
+        database.setDatabaseName(mDatabase->fileName());
+        QVERIFY(database.open());
+
+        QSqlQuery query(database);
+        QVERIFY(query.exec(R"xxx(CREATE TABLE word_image (
+                                     id INTEGER PRIMARY KEY AUTOINCREMENT,
+                                     url TEXT,
+                                     width INT NOT NULL,
+                                     height INT NOT NULL,
+                                     data BLOB))xxx"));
+        QVERIFY(query.exec(R"xxx(CREATE TABLE word (
+                                     id INTEGER PRIMARY KEY AUTOINCREMENT,
+                                     id_image INT NOT NULL,
+                                     name TEXT NOT NULL,
+                                     transcription TEXT NOT NULL,
+                                     translation TEXT NOT NULL,
+                                     association TEXT NOT NULL,
+                                     etymology TEXT NOT NULL,
+                                     description TEXT NOT NULL,
+                                     type INT NOT NULL DEFAULT (1),
+                                     date DATETIME,
+                                     FOREIGN KEY (id_image) REFERENCES word_image(id)))xxx"));
+
+        QVERIFY(query.prepare(R"xxx(INSERT INTO word (id_image, name, transcription, translation,
+                                                      association, etymology, description)
+                                    VALUES (-1, ?, '', ?, '', '', ''))xxx"));
+
+        for (const QString& name : names) {
+            query.addBindValue(name);
+            query.addBindValue("<p>translation of " + name + "</p>");
+            QVERIFY(query.exec());
+        }
+
+        database.close();
+    }
+
+    QSqlDatabase::removeDatabase(LEGACY_CONNECTION);
+}
+
+auto WordDaoMigrationTest::openWordDao() -> std::unique_ptr<WordDao> {
+    return std::make_unique<WordDao>(mDatabase->fileName(), WordDao::JournalMode::Wal, WordDao::TextEncoding::Compressed);
+}
+
+auto WordDaoMigrationTest::names(const QVector<Word>& words) -> QStringList {
+    QStringList names;
+
+    for (const Word& word : words) {
+        names.push_back(word.name);
+    }
+
+    return names;
+}
+
+void WordDaoMigrationTest::testMigrationKeepsWordsSharingKey() {
+    createLegacyDatabase({ "Masse", "Maße" });
+
+    const std::unique_ptr<WordDao> wordDao = openWordDao();
+
+    const Result<QVector<Word>, DbError> found = wordDao->search("Maße");
+    QVERIFY(found.hasValue());
+    QCOMPARE(names(found.value()), QStringList({ "Maße", "Masse" }));
+
+    const Result<QVector<Word>, DbError> other = wordDao->search("Masse");
+    QVERIFY(other.hasValue());
+    QCOMPARE(other.value().at(0).name, QString("Masse"));
+    QCOMPARE(other.value().at(0).translation, QString("<p>translation of Masse</p>"));
+}
+
+void WordDaoMigrationTest::testMigrationKeepsWordsSavedTwice() {
+    createLegacyDatabase({ "Haus", "Baum", "Haus" });
+
+    const std::unique_ptr<WordDao> wordDao = openWordDao();
+
+    Result<QStringList, DbError> saved = wordDao->getNames();
+    QVERIFY(saved.hasValue());
+    QCOMPARE(saved.value().size(), 3);
+
+    /* Saving the headword again updates the kept rows instead of adding one */
+    Word word = test::prepareWord("Haus", WordType::Noun);
+    QVERIFY(!wordDao->add(word).hasError());
+
+    saved = wordDao->getNames();
+    QVERIFY(saved.hasValue());
+    QCOMPARE(saved.value().size(), 3);
+
+    const Result<QVector<Word>, DbError> found = wordDao->search("Haus");
+    QVERIFY(found.hasValue());
+
+    for (const Word& foundWord : found.value()) {
+        QCOMPARE(foundWord.translation, word.translation);
+    }
+}
+
+void WordDaoMigrationTest::testAddKeepsWordsSharingKey() {
+    const std::unique_ptr<WordDao> wordDao = openWordDao();
+
+    QVERIFY(!wordDao->add(test::prepareWord("Masse", WordType::Noun)).hasError());
+    QVERIFY(!wordDao->add(test::prepareWord("Maße", WordType::Noun)).hasError());
+    QVERIFY(!wordDao->add(test::prepareWord("Maße", WordType::Noun)).hasError());
+
+    const Result<QVector<Word>, DbError> found = wordDao->search("masse");
+    QVERIFY(found.hasValue());
+    QCOMPARE(found.value().size(), 2);
+
+    QVERIFY(!wordDao->remove(test::prepareWord("Maße")).hasError());
+
+    const Result<QVector<Word>, DbError> kept = wordDao->search("masse");
+    QVERIFY(kept.hasValue());
+    QCOMPARE(names(kept.value()), QStringList({ "Masse" }));
+}
+
+void WordDaoMigrationTest::testMissesAreKeptPerName() {
+    const std::unique_ptr<WordDao> wordDao = openWordDao();
+    const QDateTime expiresAt = QDateTime::currentDateTime().addDays(1);
+
+    QVERIFY(!wordDao->addMiss(WordMiss { "Maße", 1, expiresAt }, 10).hasError());
+
+    const Result<std::optional<WordMiss>, DbError> missed = wordDao->findMiss("Maße");
+    QVERIFY(missed.hasValue() && missed.value().has_value());
+    QCOMPARE(missed.value()->reason, 1);
+
+    const Result<std::optional<WordMiss>, DbError> other = wordDao->findMiss("Masse");
+    QVERIFY(other.hasValue());
+    QVERIFY(!other.value().has_value());
+}
+
+void WordDaoMigrationTest::testReadOnlyOpenSkipsMigration() {
+    createLegacyDatabase({ "Masse", "Maße" });
+
+    {
+        WordDao wordDao(mDatabase->fileName(), WordDao::JournalMode::ReadOnly, WordDao::TextEncoding::Compressed);
+
+        const Result<QVector<Word>, DbError> words = wordDao.getAll();
+        QVERIFY(words.hasValue());
+        QCOMPARE(names(words.value()), QStringList({ "Masse", "Maße" }));
+
+        QVERIFY(wordDao.add(test::prepareWord("Haus")).hasError());
+    }
+
+    {
+        QSqlDatabase database = QSqlDatabase::addDatabase("QSQLITE", LEGACY_CONNECTION);
+        database.setDatabaseName(mDatabase->fileName());
+        QVERIFY(database.open());
+
+        QSqlQuery query(database);
+        QVERIFY(query.exec("PRAGMA user_version") && query.first());
+        QCOMPARE(query.value(0).toInt(), 0);
+
+        QVERIFY(query.exec("SELECT COUNT(*) FROM pragma_table_info('word') WHERE name='name_key'") && query.first());
+        QCOMPARE(query.value(0).toInt(), 0);
+
+        query = QSqlQuery{};
+        database.close();
+    }
+
+    QSqlDatabase::removeDatabase(LEGACY_CONNECTION);
+}
+
+void WordDaoMigrationTest::testReadOnlyOpenDoesNotCreateDatabase() {
+    {
+        WordDao wordDao(mDatabase->fileName(), WordDao::JournalMode::ReadOnly, WordDao::TextEncoding::Compressed);
+        QVERIFY(wordDao.getAll().hasError());
+    }
+
+    QVERIFY(!QFileInfo::exists(mDatabase->fileName()));
+}
+
+QTEST_GUILESS_MAIN(WordDaoMigrationTest)
+#include "WordDaoMigrationTest.moc"
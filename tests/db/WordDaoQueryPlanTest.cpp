@@ -0,0 +1,141 @@
+/*
+ * Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+ * SPDX-License-Identifier: MIT
+ * Copyright (c) 2023-2025 https://github.com/klappdev
+ *
+ * Permission is hereby  granted, free of charge, to any  person obtaining a copy
+ * of this software and associated  documentation files (the "Software"), to deal
+ * in the Software  without restriction, including without  limitation the rights
+ * to  use, copy,  modify, merge,  publish, distribute,  sublicense, and/or  sell
+ * copies  of  the Software,  and  to  permit persons  to  whom  the Software  is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE  IS PROVIDED "AS  IS", WITHOUT WARRANTY  OF ANY KIND,  EXPRESS OR
+ * IMPLIED,  INCLUDING BUT  NOT  LIMITED TO  THE  WARRANTIES OF  MERCHANTABILITY,
+ * FITNESS FOR  A PARTICULAR PURPOSE AND  NONINFRINGEMENT. IN NO EVENT  SHALL THE
+ * AUTHORS  OR COPYRIGHT  HOLDERS  BE  LIABLE FOR  ANY  CLAIM,  DAMAGES OR  OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF  CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE  OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <QtTest>
+
+#include "common/WordFixtures.hpp"
+#include "db/WordDao.hpp"
+
+using namespace grunwald;
+
+namespace {
+    constexpr qsizetype WORD_COUNT = 2000;
+    constexpr const char* const PLAN_CONNECTION = "grunwald_query_plan";
+
+    const QString SELECT_WORD = R"xxx(SELECT word.id, word.name, word_image.url
+                                      FROM word
+                                      LEFT JOIN word_image ON word.id_image = word_image.id)xxx";
+}
+
+/*
+ * Lookups of WordDao must stay index searches as the table grows. The
+ * statements below use the same predicates as the prepared ones.
+ */
+class WordDaoQueryPlanTest final : public QObject {
+    Q_OBJECT
+private slots:
+    void initTestCase();
+    void cleanupTestCase();
+
+    void testLookupUsesIndex_data();
+    void testLookupUsesIndex();
+
+private:
+    auto queryPlan(const QString& sql) -> QStringList;
+
+    std::unique_ptr<test::TemporaryDatabase> mDatabase;
+};
+
+void WordDaoQueryPlanTest::initTestCase() {
+    mDatabase = std::make_unique<test::TemporaryDatabase>();
+
+    WordDao wordDao(mDatabase->fileName(), WordDao::JournalMode::Wal, WordDao::TextEncoding::Compressed);
+    const QVector<Word> words = test::prepareWords(WORD_COUNT);
+
+    QVERIFY(!wordDao.addBatch(QSpan<const Word>(words)).constLast().hasError());
+    QVERIFY(!wordDao.analyze().hasError());
+}
+
+void WordDaoQueryPlanTest::cleanupTestCase() {
+    QSqlDatabase::database(PLAN_CONNECTION, false).close();
+    QSqlDatabase::removeDatabase(PLAN_CONNECTION);
+    mDatabase.reset();
+}
+
+auto WordDaoQueryPlanTest::queryPlan(const QString& sql) -> QStringList {
+    QSqlDatabase database = QSqlDatabase::contains(PLAN_CONNECTION)
+                          ? QSqlDatabase::database(PLAN_CONNECTION)
+                          : QSqlDatabase::addDatabase("QSQLITE", PLAN_CONNECTION);
+
+    if (!database.isOpen()) {
+        database.setDatabaseName(mDatabase->fileName());
+        database.open();
+    }
+
+    static const QRegularExpression placeholderRegex(R"xxx(\?|:\w+)xxx");
+
+    QString explainSql = sql;
+    explainSql.replace(placeholderRegex, "0");
+
+    QSqlQuery query(database);
+    QStringList details;
+
+    if (!query.exec("EXPLAIN QUERY PLAN " + explainSql)) {
+        qWarning() << "Explain query plan error:" << query.lastError();
+        return details;
+    }
+
+    while (query.next()) {
+        details.push_back(query.value("detail").toString());
+    }
+
+    return details;
+}
+
+void WordDaoQueryPlanTest::testLookupUsesIndex_data() {
+    QTest::addColumn<QString>("sql");
+    QTest::addColumn<QString>("table");
+
+    QTest::addRow("checkIfExists") << "SELECT COUNT(*) FROM word WHERE name=?" << "word";
+    QTest::addRow("search") << SELECT_WORD + " WHERE word.name_key = :name_key" << "word";
+    QTest::addRow("updateByName") << "UPDATE word SET date=? WHERE name=?" << "word";
+    QTest::addRow("remove") << "DELETE FROM word WHERE name=?" << "word";
+    QTest::addRow("page") << SELECT_WORD + R"xxx( WHERE (word.name, word.id) > (:after_name, :after_id)
+                                                  ORDER BY word.name, word.id
+                                                  LIMIT :limit)xxx" << "word";
+    QTest::addRow("findImage") << "SELECT id FROM word_image WHERE hash=?" << "word_image";
+    QTest::addRow("findMiss") << "SELECT reason, expires_at FROM word_miss WHERE name=:name AND expires_at > :now" << "word_miss";
+}
+
+void WordDaoQueryPlanTest::testLookupUsesIndex() {
+    QFETCH(QString, sql);
+    QFETCH(QString, table);
+
+    const QStringList details = queryPlan(sql);
+    QVERIFY2(!details.isEmpty(), qPrintable(sql));
+
+    bool searchesTable = false;
+
+    for (const QString& detail : details) {
+        QVERIFY2(!detail.startsWith("SCAN " + table + ' ') && detail != "SCAN " + table, qPrintable(detail));
+        QVERIFY2(!detail.contains("USE TEMP B-TREE"), qPrintable(detail));
+
+        searchesTable = searchesTable || detail.startsWith("SEARCH " + table + ' ');
+    }
+
+    QVERIFY2(searchesTable, qPrintable(details.join("; ")));
+}
+
+QTEST_GUILESS_MAIN(WordDaoQueryPlanTest)
+#include "WordDaoQueryPlanTest.moc"
@@ -0,0 +1,109 @@
+/*
+ * Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+ * SPDX-License-Identifier: MIT
+ * Copyright (c) 2023-2025 https://github.com/klappdev
+ *
+ * Permission is hereby  granted, free of charge, to any  person obtaining a copy
+ * of this software and associated  documentation files (the "Software"), to deal
+ * in the Software  without restriction, including without  limitation the rights
+ * to  use, copy,  modify, merge,  publish, distribute,  sublicense, and/or  sell
+ * copies  of  the Software,  and  to  permit persons  to  whom  the Software  is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE  IS PROVIDED "AS  IS", WITHOUT WARRANTY  OF ANY KIND,  EXPRESS OR
+ * IMPLIED,  INCLUDING BUT  NOT  LIMITED TO  THE  WARRANTIES OF  MERCHANTABILITY,
+ * FITNESS FOR  A PARTICULAR PURPOSE AND  NONINFRINGEMENT. IN NO EVENT  SHALL THE
+ * AUTHORS  OR COPYRIGHT  HOLDERS  BE  LIABLE FOR  ANY  CLAIM,  DAMAGES OR  OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF  CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE  OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <QtTest>
+
+#include "common/WordFixtures.hpp"
+#include "db/WordDao.hpp"
+#include "import/WordImporter.hpp"
+
+using namespace grunwald;
+
+class WordImporterTest final : public QObject {
+    Q_OBJECT
+private slots:
+    void init();
+    void cleanup();
+
+    void testFirstEntryOfHeadwordIsKept();
+    void testImportAgainSkipsSavedWords();
+
+private:
+    void writeDump(const QStringList& lines);
+
+    std::unique_ptr<test::TemporaryDatabase> mDatabase;
+    std::unique_ptr<WordDao> mWordDao;
+    QString mDumpFileName;
+};
+
+void WordImporterTest::init() {
+    mDatabase = std::make_unique<test::TemporaryDatabase>();
+    mWordDao = std::make_unique<WordDao>(mDatabase->fileName(), WordDao::JournalMode::Exclusive, WordDao::TextEncoding::Compressed);
+    mDumpFileName = mDatabase->fileName("dump.jsonl");
+
+    /*
+     * Parts of speech of one headword are not adjacent, all of them land in one chunk.
+     */
+    writeDump({
+        R"({"word": "Haus", "lang": "German", "pos": "noun", "senses": [{"glosses": ["house"]}]})",
+        R"({"word": "Baum", "lang": "German", "pos": "noun", "senses": [{"glosses": ["tree"]}]})",
+        R"({"word": "house", "lang": "English", "pos": "noun", "senses": [{"glosses": ["Haus"]}]})",
+        R"({"word": "Haus", "lang": "German", "pos": "verb", "senses": [{"glosses": ["to dwell"]}]})",
+    });
+}
+
+void WordImporterTest::cleanup() {
+    mWordDao.reset();
+    mDatabase.reset();
+}
+
+void WordImporterTest::writeDump(const QStringList& lines) {
+    QFile dumpFile(mDumpFileName);
+    QVERIFY(dumpFile.open(QIODevice::WriteOnly));
+    QVERIFY(dumpFile.write(lines.join('\n').toUtf8() + '\n') > 0);
+}
+
+void WordImporterTest::testFirstEntryOfHeadwordIsKept() {
+    WordImporter importer(*mWordDao);
+
+    const Result<WordImporter::Stats, ImportError> stats = importer.run(mDumpFileName);
+    QVERIFY(stats.hasValue());
+    QCOMPARE(stats->entries, qint64(4));
+    QCOMPARE(stats->imported, qint64(2));
+    QCOMPARE(stats->skipped, qint64(2));
+    QCOMPARE(stats->failed, qint64(0));
+
+    const Result<QVector<Word>, DbError> found = mWordDao->search("Haus");
+    QVERIFY(found.hasValue());
+    QCOMPARE(found.value().size(), 1);
+    QCOMPARE(found.value().at(0).type, WordType::Noun);
+    QVERIFY(found.value().at(0).translation.contains("house"));
+}
+
+void WordImporterTest::testImportAgainSkipsSavedWords() {
+    WordImporter importer(*mWordDao);
+    QVERIFY(importer.run(mDumpFileName).hasValue());
+
+    const Result<WordImporter::Stats, ImportError> stats = importer.run(mDumpFileName);
+    QVERIFY(stats.hasValue());
+    QCOMPARE(stats->imported, qint64(0));
+    QCOMPARE(stats->skipped, qint64(4));
+
+    const Result<QStringList, DbError> names = mWordDao->getNames();
+    QVERIFY(names.hasValue());
+    QCOMPARE(names.value().size(), 2);
+}
+
+QTEST_GUILESS_MAIN(WordImporterTest)
+#include "WordImporterTest.moc"
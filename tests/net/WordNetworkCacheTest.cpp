@@ -0,0 +1,289 @@
+/*
+ * Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+ * SPDX-License-Identifier: MIT
+ * Copyright (c) 2023-2025 https://github.com/klappdev
+ *
+ * Permission is hereby  granted, free of charge, to any  person obtaining a copy
+ * of this software and associated  documentation files (the "Software"), to deal
+ * in the Software  without restriction, including without  limitation the rights
+ * to  use, copy,  modify, merge,  publish, distribute,  sublicense, and/or  sell
+ * copies  of  the Software,  and  to  permit persons  to  whom  the Software  is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE  IS PROVIDED "AS  IS", WITHOUT WARRANTY  OF ANY KIND,  EXPRESS OR
+ * IMPLIED,  INCLUDING BUT  NOT  LIMITED TO  THE  WARRANTIES OF  MERCHANTABILITY,
+ * FITNESS FOR  A PARTICULAR PURPOSE AND  NONINFRINGEMENT. IN NO EVENT  SHALL THE
+ * AUTHORS  OR COPYRIGHT  HOLDERS  BE  LIABLE FOR  ANY  CLAIM,  DAMAGES OR  OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF  CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE  OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <QtTest>
+#include <QNetworkAccessManager>
+#include <QNetworkProxy>
+#include <QNetworkReply>
+#include <QTcpServer>
+#include <QTcpSocket>
+
+#include "net/WordNetworkCache.hpp"
+
+#include <atomic>
+#include <memory>
+
+using namespace grunwald;
+
+namespace {
+    constexpr qint32 CONCURRENT_URLS = 20;
+    constexpr qint32 FETCH_TIMEOUT_MS = 10000;
+
+    /*
+     * Answers like Wiktionary does: /fresh/ pages may be cached for an hour,
+     * /stale/ pages have an ETag and must be revalidated on every request.
+     */
+    class HttpStandIn final : public QObject {
+    public:
+        explicit HttpStandIn(QObject* parent = nullptr) : QObject(parent) {
+            QObject::connect(&mServer, &QTcpServer::newConnection, this, [this]() {
+                while (QTcpSocket* socket = mServer.nextPendingConnection()) {
+                    QObject::connect(socket, &QTcpSocket::readyRead, this, [this, socket]() {
+                        onReadyRead(socket);
+                    });
+                    QObject::connect(socket, &QTcpSocket::disconnected, socket, &QObject::deleteLater);
+                }
+            });
+        }
+
+        bool listen() {
+            return mServer.listen(QHostAddress::LocalHost);
+        }
+
+        auto url(const QString& path) const -> QUrl {
+            return QUrl(QString("http://127.0.0.1:%1%2").arg(mServer.serverPort()).arg(path));
+        }
+
+        auto requests(const QString& path) const -> qint32 {
+            return mRequests.value(path);
+        }
+
+        auto totalRequests() const -> qint32 {
+            qint32 total = 0;
+
+            for (const qint32 count : mRequests) {
+                total += count;
+            }
+
+            return total;
+        }
+
+        auto conditionalRequests() const -> qint32 {
+            return mConditionalRequests;
+        }
+
+        void reset() {
+            mRequests.clear();
+            mConditionalRequests = 0;
+        }
+
+    private:
+        void onReadyRead(QTcpSocket* socket) {
+            QByteArray& buffer = mBuffers[socket];
+            buffer += socket->readAll();
+
+            /* Persistent connections may carry several requests */
+            for (qsizetype end = buffer.indexOf("\r\n\r\n"); end >= 0; end = buffer.indexOf("\r\n\r\n")) {
+                const QList<QByteArray> lines = buffer.left(end).split('\n');
+                buffer.remove(0, end + 4);
+
+                const QList<QByteArray> requestLine = lines.first().trimmed().split(' ');
+                const QString path = requestLine.size() > 1 ? QString::fromUtf8(requestLine.at(1)) : QString{};
+                QByteArray etag;
+
+                for (const QByteArray& line : lines) {
+                    if (line.toLower().startsWith("if-none-match:")) {
+                        etag = line.mid(line.indexOf(':') + 1).trimmed();
+                    }
+                }
+
+                socket->write(respond(path, etag));
+            }
+        }
+
+        auto respond(const QString& path, const QByteArray& etag) -> QByteArray {
+            ++mRequests[path];
+
+            const QByteArray date = QLocale::c().toString(QDateTime::currentDateTimeUtc(), "ddd, dd MMM yyyy hh:mm:ss 'GMT'").toLatin1();
+            const QByteArray body = path.toUtf8();
+
+            if (path.startsWith("/fresh/")) {
+                return "HTTP/1.1 200 OK\r\nDate: " + date + "\r\nCache-Control: max-age=3600\r\n"
+                       "Content-Length: " + QByteArray::number(body.size()) + "\r\n\r\n" + body;
+            }
+
+            if (etag == "\"v1\"") {
+                ++mConditionalRequests;
+
+                return "HTTP/1.1 304 Not Modified\r\nDate: " + date + "\r\nCache-Control: max-age=0\r\n"
+                       "ETag: \"v1\"\r\nContent-Length: 0\r\n\r\n";
+            }
+
+            return "HTTP/1.1 200 OK\r\nDate: " + date + "\r\nCache-Control: max-age=0\r\nETag: \"v1\"\r\n"
+                   "Content-Length: " + QByteArray::number(body.size()) + "\r\n\r\n" + body;
+        }
+
+        QTcpServer mServer;
+        QHash<QTcpSocket*, QByteArray> mBuffers;
+        QHash<QString, qint32> mRequests;
+        qint32 mConditionalRequests = 0;
+    };
+
+    /*
+     * Manager set up like the ones of the content and image services.
+     */
+    auto prepareManager() -> std::unique_ptr<QNetworkAccessManager> {
+        auto manager = std::make_unique<QNetworkAccessManager>();
+        manager->setProxy(QNetworkProxy::NoProxy);
+        manager->setCache(new WordNetworkCache(manager.get()));
+
+        return manager;
+    }
+
+    auto fetch(QNetworkAccessManager& manager, const QUrl& url) -> QByteArray {
+        const std::unique_ptr<QNetworkReply> reply(manager.get(QNetworkRequest(url)));
+
+        if (!reply->isFinished()) {
+            QEventLoop eventLoop;
+            QObject::connect(reply.get(), &QNetworkReply::finished, &eventLoop, &QEventLoop::quit);
+            QTimer::singleShot(FETCH_TIMEOUT_MS, &eventLoop, &QEventLoop::quit);
+            eventLoop.exec();
+        }
+
+        return reply->isFinished() && reply->error() == QNetworkReply::NoError ? reply->readAll() : QByteArray{};
+    }
+}
+
+class WordNetworkCacheTest final : public QObject {
+    Q_OBJECT
+private slots:
+    void initTestCase();
+    void init();
+
+    void testStoreAndHit();
+    void testRevalidate();
+    void testSharedBetweenManagers();
+    void testConcurrentAccess();
+
+private:
+    HttpStandIn mServer;
+};
+
+void WordNetworkCacheTest::initTestCase() {
+    /* The disk cache goes into a test location, not the user's cache */
+    QStandardPaths::setTestModeEnabled(true);
+
+    QVERIFY(mServer.listen());
+}
+
+void WordNetworkCacheTest::init() {
+    WordNetworkCache().clear();
+    mServer.reset();
+}
+
+void WordNetworkCacheTest::testStoreAndHit() {
+    const auto manager = prepareManager();
+    const WordNetworkCache::Stats before = WordNetworkCache::stats();
+
+    QCOMPARE(fetch(*manager, mServer.url("/fresh/Haus")), QByteArray("/fresh/Haus"));
+    QCOMPARE(fetch(*manager, mServer.url("/fresh/Haus")), QByteArray("/fresh/Haus"));
+
+    const WordNetworkCache::Stats after = WordNetworkCache::stats();
+    QCOMPARE(mServer.requests("/fresh/Haus"), 1);
+    QCOMPARE(after.misses - before.misses, qint64(1));
+    QCOMPARE(after.stored - before.stored, qint64(1));
+    QCOMPARE(after.hits - before.hits, qint64(1));
+    QCOMPARE(after.revalidated - before.revalidated, qint64(0));
+}
+
+void WordNetworkCacheTest::testRevalidate() {
+    const auto manager = prepareManager();
+    const WordNetworkCache::Stats before = WordNetworkCache::stats();
+
+    QCOMPARE(fetch(*manager, mServer.url("/stale/Baum")), QByteArray("/stale/Baum"));
+    QCOMPARE(fetch(*manager, mServer.url("/stale/Baum")), QByteArray("/stale/Baum"));
+
+    const WordNetworkCache::Stats after = WordNetworkCache::stats();
+    QCOMPARE(mServer.requests("/stale/Baum"), 2);
+    QCOMPARE(mServer.conditionalRequests(), 1);
+    QCOMPARE(after.misses - before.misses, qint64(1));
+    QCOMPARE(after.stored - before.stored, qint64(1));
+    QCOMPARE(after.revalidated - before.revalidated, qint64(1));
+    QCOMPARE(after.hits - before.hits, qint64(1));
+}
+
+void WordNetworkCacheTest::testSharedBetweenManagers() {
+    const auto contentManager = prepareManager();
+    const auto imageManager = prepareManager();
+
+    const WordNetworkCache::Stats before = WordNetworkCache::stats();
+
+    QCOMPARE(fetch(*contentManager, mServer.url("/fresh/Wald")), QByteArray("/fresh/Wald"));
+    QCOMPARE(fetch(*imageManager, mServer.url("/fresh/Wald")), QByteArray("/fresh/Wald"));
+
+    const WordNetworkCache::Stats after = WordNetworkCache::stats();
+    QCOMPARE(mServer.requests("/fresh/Wald"), 1);
+    QCOMPARE(after.misses - before.misses, qint64(1));
+    QCOMPARE(after.hits - before.hits, qint64(1));
+}
+
+/*
+ * Content and image services live on different threads and share one disk cache.
+ */
+void WordNetworkCacheTest::testConcurrentAccess() {
+    QList<QUrl> urls;
+
+    for (qint32 i = 0; i < CONCURRENT_URLS; ++i) {
+        urls.push_back(mServer.url(QString("/%1/wort%2").arg(i % 2 == 0 ? "fresh" : "stale").arg(i)));
+    }
+
+    std::atomic<qint32> wrongBodies = 0;
+
+    const auto fetchAll = [&urls, &wrongBodies]() {
+        const auto manager = prepareManager();
+
+        for (const QUrl& url : urls) {
+            if (fetch(*manager, url) != url.path().toUtf8()) {
+                ++wrongBodies;
+            }
+        }
+    };
+
+    const auto runConcurrently = [&fetchAll]() {
+        std::unique_ptr<QThread> contentThread(QThread::create(fetchAll));
+        std::unique_ptr<QThread> imageThread(QThread::create(fetchAll));
+
+        contentThread->start();
+        imageThread->start();
+
+        /* The server answers on this thread */
+        QTRY_VERIFY_WITH_TIMEOUT(contentThread->isFinished() && imageThread->isFinished(), CONCURRENT_URLS * FETCH_TIMEOUT_MS);
+    };
+
+    runConcurrently();
+    QCOMPARE(wrongBodies.load(), 0);
+
+    const qint32 firstRoundRequests = mServer.totalRequests();
+    const qint32 firstRoundConditional = mServer.conditionalRequests();
+
+    runConcurrently();
+    QCOMPARE(wrongBodies.load(), 0);
+
+    /* Fresh pages come from the cache, stale ones are only revalidated */
+    QCOMPARE(mServer.totalRequests() - firstRoundRequests, CONCURRENT_URLS);
+    QCOMPARE(mServer.conditionalRequests() - firstRoundConditional, CONCURRENT_URLS);
+}
+
+QTEST_GUILESS_MAIN(WordNetworkCacheTest)
+#include "WordNetworkCacheTest.moc"
@@ -0,0 +1,128 @@
+/*
+ * Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+ * SPDX-License-Identifier: MIT
+ * Copyright (c) 2023-2025 https://github.com/klappdev
+ *
+ * Permission is hereby  granted, free of charge, to any  person obtaining a copy
+ * of this software and associated  documentation files (the "Software"), to deal
+ * in the Software  without restriction, including without  limitation the rights
+ * to  use, copy,  modify, merge,  publish, distribute,  sublicense, and/or  sell
+ * copies  of  the Software,  and  to  permit persons  to  whom  the Software  is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE  IS PROVIDED "AS  IS", WITHOUT WARRANTY  OF ANY KIND,  EXPRESS OR
+ * IMPLIED,  INCLUDING BUT  NOT  LIMITED TO  THE  WARRANTIES OF  MERCHANTABILITY,
+ * FITNESS FOR  A PARTICULAR PURPOSE AND  NONINFRINGEMENT. IN NO EVENT  SHALL THE
+ * AUTHORS  OR COPYRIGHT  HOLDERS  BE  LIABLE FOR  ANY  CLAIM,  DAMAGES OR  OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF  CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE  OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <QtTest>
+
+#include "storage/WordSuggestionIndex.hpp"
+
+using namespace grunwald;
+
+class WordSuggestionIndexTest final : public QObject {
+    Q_OBJECT
+private slots:
+    void testSuggestsCloseWords();
+    void testRemovedWordIsNotSuggested();
+    void testReinsertedWordIsFoundAgain();
+    void testSaveRemoveCyclesKeepResults();
+    void testCompleteByPrefix();
+    void testNamesSharingKeyAreKeptApart();
+};
+
+void WordSuggestionIndexTest::testSuggestsCloseWords() {
+    WordSuggestionIndex index;
+    index.reset({ "Haus", "Maus", "Hund", "Straße" });
+
+    const QStringList suggestions = index.suggest("Hauss", 5, 2);
+
+    QVERIFY(!suggestions.isEmpty());
+    QCOMPARE(suggestions.at(0), QString("Haus"));
+    QVERIFY(!suggestions.contains("Straße"));
+}
+
+void WordSuggestionIndexTest::testRemovedWordIsNotSuggested() {
+    WordSuggestionIndex index;
+    index.reset({ "Haus", "Maus" });
+
+    index.remove("Haus");
+
+    QCOMPARE(index.size(), 1);
+    QVERIFY(!index.suggest("Hauss", 5, 2).contains("Haus"));
+}
+
+void WordSuggestionIndexTest::testReinsertedWordIsFoundAgain() {
+    WordSuggestionIndex index;
+    index.reset({ "Haus", "Maus" });
+
+    index.remove("Haus");
+    index.insert("Haus");
+
+    QCOMPARE(index.size(), 2);
+    QCOMPARE(index.suggest("Hauss", 5, 1), QStringList { "Haus" });
+    QCOMPARE(index.complete("Ha", 5), QStringList { "Haus" });
+}
+
+void WordSuggestionIndexTest::testSaveRemoveCyclesKeepResults() {
+    WordSuggestionIndex index;
+    QStringList names;
+
+    for (qint32 i = 0; i < 200; ++i) {
+        names.push_back(QString("Wort%1").arg(i, 3, 10, QChar('0')));
+    }
+
+    index.reset(names);
+
+    for (qint32 cycle = 0; cycle < 50; ++cycle) {
+        for (qint32 i = 0; i < 100; ++i) {
+            index.remove(names.at(i));
+        }
+
+        for (qint32 i = 0; i < 100; ++i) {
+            index.insert(names.at(i));
+        }
+    }
+
+    QCOMPARE(index.size(), names.size());
+    QCOMPARE(index.complete("Wort00", 20).size(), 10);
+    QCOMPARE(index.suggest("Wort00x", 1, 1), QStringList { "Wort000" });
+}
+
+void WordSuggestionIndexTest::testCompleteByPrefix() {
+    WordSuggestionIndex index;
+    index.reset({ "gehen", "geben", "Gebäude", "Gehweg", "laufen" });
+
+    QCOMPARE(index.complete("geh", 5), (QStringList { "gehen", "Gehweg" }));
+    QVERIFY(index.complete("x", 5).isEmpty());
+}
+
+void WordSuggestionIndexTest::testNamesSharingKeyAreKeptApart() {
+    WordSuggestionIndex index;
+    index.reset({ "Maße", "Masse" });
+
+    QCOMPARE(index.size(), 2);
+
+    index.remove("Masse");
+
+    QCOMPARE(index.size(), 1);
+    QCOMPARE(index.complete("Mas", 5), QStringList { "Maße" });
+
+    index.insert("Masse");
+
+    QStringList completions = index.complete("Mas", 5);
+    completions.sort();
+
+    QCOMPARE(completions, (QStringList { "Masse", "Maße" }));
+}
+
+QTEST_GUILESS_MAIN(WordSuggestionIndexTest)
+#include "WordSuggestionIndexTest.moc"
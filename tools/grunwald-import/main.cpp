@@ -0,0 +1,71 @@
+/*
+ * Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+ * SPDX-License-Identifier: MIT
+ * Copyright (c) 2023-2025 https://github.com/klappdev
+ *
+ * Permission is hereby  granted, free of charge, to any  person obtaining a copy
+ * of this software and associated  documentation files (the "Software"), to deal
+ * in the Software  without restriction, including without  limitation the rights
+ * to  use, copy,  modify, merge,  publish, distribute,  sublicense, and/or  sell
+ * copies  of  the Software,  and  to  permit persons  to  whom  the Software  is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE  IS PROVIDED "AS  IS", WITHOUT WARRANTY  OF ANY KIND,  EXPRESS OR
+ * IMPLIED,  INCLUDING BUT  NOT  LIMITED TO  THE  WARRANTIES OF  MERCHANTABILITY,
+ * FITNESS FOR  A PARTICULAR PURPOSE AND  NONINFRINGEMENT. IN NO EVENT  SHALL THE
+ * AUTHORS  OR COPYRIGHT  HOLDERS  BE  LIABLE FOR  ANY  CLAIM,  DAMAGES OR  OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF  CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE  OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <QCoreApplication>
+#include <QCommandLineParser>
+#include <QDebug>
+
+#include "db/WordDao.hpp"
+#include "import/WordImporter.hpp"
+
+/*
+ * Imports German entries of a Wiktextract JSONL dump into a Grunwald database:
+ *
+ *   grunwald-import kaikki.org-dictionary-German.jsonl grunwald.sqlite
+ *
+ * Run it again after an interruption, the import resumes from the checkpoint.
+ */
+int main(int argc, char *argv[]) {
+    QCoreApplication app(argc, argv);
+    QCoreApplication::setApplicationName("grunwald-import");
+
+    QCommandLineParser parser;
+    parser.setApplicationDescription("Imports a Wiktextract JSONL dump into a Grunwald database");
+    parser.addHelpOption();
+    parser.addPositionalArgument("dump", "Wiktextract JSONL dump");
+    parser.addPositionalArgument("database", "Destination SQLite database");
+    parser.process(app);
+
+    const QStringList arguments = parser.positionalArguments();
+
+    if (arguments.size() != 2) {
+        parser.showHelp(1);
+    }
+
+    grunwald::WordDao wordDao(arguments.at(1), grunwald::WordDao::JournalMode::Exclusive, grunwald::WordDao::TextEncoding::Compressed);
+    grunwald::WordImporter importer(wordDao);
+
+    const auto stats = importer.run(arguments.at(0));
+
+    if (stats.hasError()) {
+        qCritical() << "Import failed: " << stats.error() << Qt::endl;
+        return 1;
+    }
+
+    qInfo() << "Import finished, entries: " << stats->entries << ", imported: " << stats->imported
+            << ", skipped: " << stats->skipped << ", failed: " << stats->failed
+            << ", " << qRound(stats->entriesPerSecond()) << " entries/s" << Qt::endl;
+
+    return 0;
+}
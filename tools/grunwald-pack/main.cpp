@@ -0,0 +1,79 @@
+/*
+ * Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+ * SPDX-License-Identifier: MIT
+ * Copyright (c) 2023-2025 https://github.com/klappdev
+ *
+ * Permission is hereby  granted, free of charge, to any  person obtaining a copy
+ * of this software and associated  documentation files (the "Software"), to deal
+ * in the Software  without restriction, including without  limitation the rights
+ * to  use, copy,  modify, merge,  publish, distribute,  sublicense, and/or  sell
+ * copies  of  the Software,  and  to  permit persons  to  whom  the Software  is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE  IS PROVIDED "AS  IS", WITHOUT WARRANTY  OF ANY KIND,  EXPRESS OR
+ * IMPLIED,  INCLUDING BUT  NOT  LIMITED TO  THE  WARRANTIES OF  MERCHANTABILITY,
+ * FITNESS FOR  A PARTICULAR PURPOSE AND  NONINFRINGEMENT. IN NO EVENT  SHALL THE
+ * AUTHORS  OR COPYRIGHT  HOLDERS  BE  LIABLE FOR  ANY  CLAIM,  DAMAGES OR  OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF  CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE  OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <QCoreApplication>
+#include <QCommandLineParser>
+#include <QDebug>
+#include <QFileInfo>
+
+#include "db/WordDao.hpp"
+#include "pack/WordPackWriter.hpp"
+
+/*
+ * Builds a read-only dictionary pack from a Grunwald database:
+ *
+ *   grunwald-pack grunwald.sqlite grunwald.pack
+ */
+int main(int argc, char *argv[]) {
+    QCoreApplication app(argc, argv);
+    QCoreApplication::setApplicationName("grunwald-pack");
+
+    QCommandLineParser parser;
+    parser.setApplicationDescription("Builds a memory-mapped dictionary pack from a Grunwald database");
+    parser.addHelpOption();
+    parser.addPositionalArgument("database", "Source SQLite database");
+    parser.addPositionalArgument("pack", "Destination dictionary pack");
+    parser.process(app);
+
+    const QStringList arguments = parser.positionalArguments();
+
+    if (arguments.size() != 2) {
+        parser.showHelp(1);
+    }
+
+    /*
+     * The source is only read: a mistyped path must not create an empty database.
+     */
+    if (!QFileInfo(arguments.at(0)).isFile()) {
+        qCritical() << "Database doesn't exist: " << arguments.at(0) << Qt::endl;
+        return 1;
+    }
+
+    grunwald::WordDao wordDao(arguments.at(0), grunwald::WordDao::JournalMode::ReadOnly, grunwald::WordDao::TextEncoding::Compressed);
+    const auto words = wordDao.getAll();
+
+    if (words.hasError()) {
+        qCritical() << "Can't read words: " << words.error() << Qt::endl;
+        return 1;
+    }
+
+    const auto written = grunwald::WordPackWriter::write(arguments.at(1), *words);
+
+    if (written.hasError()) {
+        qCritical() << "Can't write dictionary pack: " << written.error() << Qt::endl;
+        return 1;
+    }
+
+    return 0;
+}